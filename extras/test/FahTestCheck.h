@@ -0,0 +1,18 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include <cstdio>
+#include <cstdlib>
+
+//Test check that is also evaluated with NDEBUG, a Release build runs the same checks and calls as a Debug build
+#define FAH_CHECK(Condition) do { if (!(Condition)) { fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); abort(); } } while (0)
@@ -0,0 +1,11 @@
+//Host test stand-in, only what the library uses. Not part of the Arduino build.
+#include "Arduino.h"
+#include "WiFi.h"
+#include "WiFiClient.h"
+
+unsigned long __fake_millis = 1000;
+unsigned long __fake_micros = 0;
+HardwareSerial Serial;
+WiFiClass WiFi;
+WiFiClient* WiFiClient::Last = nullptr;
+std::string WiFiClient::ConnectResponse;
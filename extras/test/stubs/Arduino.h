@@ -0,0 +1,138 @@
+#pragma once
+//Host test stand-in, only what the library uses. Not part of the Arduino build.
+#include <string>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+#define PROGMEM
+#define PSTR(s) (s)
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper*>(p))
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define pgm_read_ptr(p) (*(void* const*)(p))
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define memcmp_P memcmp
+#define strstr_P strstr
+#define strcasecmp_P strcasecmp
+#define PGM_P const char*
+#define strncmp_P strncmp
+#define strncasecmp_P strncasecmp
+#define memcpy_P memcpy
+inline char* utoa(unsigned v, char* b, int) { sprintf(b, "%u", v); return b; }
+#define HEX 16
+#define DEC 10
+#include <strings.h>
+extern unsigned long __fake_millis;
+extern unsigned long __fake_micros;
+inline unsigned long millis() { return __fake_millis; }
+inline unsigned long micros() { return __fake_micros; }
+inline void delay(unsigned long ms) { __fake_millis += ms; }
+inline void yield() {}
+inline long random(long a, long b) { return a + (std::rand() % (b - a)); }
+inline long random(long b) { return std::rand() % b; }
+inline int analogRead(uint8_t) { return 0; }
+class String {
+public:
+  std::string s;
+  String() {}
+  String(const char* c) : s(c ? c : "") {}
+  String(const __FlashStringHelper* c) : s((const char*)c) {}
+  String(const std::string& x) : s(x) {}
+  String(char c) : s(1, c) {}
+  String(int v, unsigned char base = 10) { fromL(v, base); }
+  String(unsigned int v, unsigned char base = 10) { fromUL(v, base); }
+  String(long v, unsigned char base = 10) { fromL(v, base); }
+  String(unsigned long v, unsigned char base = 10) { fromUL(v, base); }
+  String(unsigned char v, unsigned char base = 10) { fromUL(v, base); }
+  String(float v, unsigned char dec = 2) { char b[64]; snprintf(b, 64, "%.*f", dec, v); s = b; }
+  String(double v, unsigned char dec = 2) { char b[64]; snprintf(b, 64, "%.*f", dec, v); s = b; }
+  void fromL(long v, int base) { if (base == 10) s = std::to_string(v); else fromUL((unsigned long)v, base); }
+  void fromUL(unsigned long v, int base) { char b[70]; int i = 69; b[i] = 0; if (!v) b[--i] = '0'; while (v) { int d = v % base; b[--i] = d < 10 ? '0' + d : 'a' + d - 10; v /= base; } s = &b[i]; }
+  unsigned int length() const { return s.size(); }
+  const char* c_str() const { return s.c_str(); }
+  bool reserve(unsigned int n) { s.reserve(n); return true; }
+  int indexOf(char c, unsigned int from = 0) const { auto p = s.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(const String& c, unsigned int from = 0) const { auto p = s.find(c.s, from); return p == std::string::npos ? -1 : (int)p; }
+  int lastIndexOf(char c) const { auto p = s.rfind(c); return p == std::string::npos ? -1 : (int)p; }
+  String substring(unsigned int a) const { return a > s.size() ? String() : String(s.substr(a)); }
+  String substring(unsigned int a, unsigned int b) const { if (a > b) std::swap(a, b); if (a > s.size()) return String(); return String(s.substr(a, std::min<size_t>(b, s.size()) - a)); }
+  long toInt() const { return atol(s.c_str()); }
+  float toFloat() const { return atof(s.c_str()); }
+  void toLowerCase() { for (auto& c : s) c = tolower(c); }
+  void toUpperCase() { for (auto& c : s) c = toupper(c); }
+  void trim() { while (!s.empty() && isspace((unsigned char)s.back())) s.pop_back(); size_t i = 0; while (i < s.size() && isspace((unsigned char)s[i])) i++; s.erase(0, i); }
+  char charAt(unsigned int i) const { return i < s.size() ? s[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char& operator[](unsigned int i) { return s[i]; }
+  void replace(char a, char b) { for (auto& c : s) if (c == a) c = b; }
+  void replace(const String& a, const String& b) { size_t p = 0; while ((p = s.find(a.s, p)) != std::string::npos) { s.replace(p, a.s.size(), b.s); p += b.s.size(); } }
+  bool startsWith(const String& o) const { return s.compare(0, o.s.size(), o.s) == 0; }
+  bool endsWith(const String& o) const { return s.size() >= o.s.size() && s.compare(s.size() - o.s.size(), o.s.size(), o.s) == 0; }
+  bool equalsIgnoreCase(const String& o) const { return strcasecmp(s.c_str(), o.s.c_str()) == 0; }
+  bool concat(const char* c, unsigned int n) { s.append(c, n); return true; }
+  bool concat(const String& o) { s += o.s; return true; }
+  bool concat(char c) { s += c; return true; }
+  void remove(unsigned int i) { if (i < s.size()) s.erase(i); }
+  void remove(unsigned int i, unsigned int n) { if (i < s.size()) s.erase(i, n); }
+  String& operator+=(const String& o) { s += o.s; return *this; }
+  String& operator+=(const char* o) { s += o; return *this; }
+  String& operator+=(char c) { s += c; return *this; }
+  String& operator+=(int v) { s += std::to_string(v); return *this; }
+  String& operator+=(unsigned int v) { s += std::to_string(v); return *this; }
+  String& operator+=(long v) { s += std::to_string(v); return *this; }
+  String& operator+=(unsigned long v) { s += std::to_string(v); return *this; }
+  String& operator+=(const __FlashStringHelper* o) { s += (const char*)o; return *this; }
+  friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+  friend String operator+(const String& a, const char* b) { return String(a.s + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b.s); }
+  friend String operator+(const String& a, char b) { return String(a.s + b); }
+  friend String operator+(const String& a, const __FlashStringHelper* b) { return String(a.s + (const char*)b); }
+  friend String operator+(const String& a, int b) { return String(a.s + std::to_string(b)); }
+  friend String operator+(const String& a, unsigned int b) { return String(a.s + std::to_string(b)); }
+  friend String operator+(const String& a, unsigned long b) { return String(a.s + std::to_string(b)); }
+  friend bool operator==(const String& a, const String& b) { return a.s == b.s; }
+  friend bool operator==(const String& a, const char* b) { return a.s == b; }
+  friend bool operator!=(const String& a, const String& b) { return a.s != b.s; }
+  friend bool operator!=(const String& a, const char* b) { return a.s != b; }
+};
+class Print {
+public:
+  virtual size_t write(uint8_t) { return 1; }
+  virtual size_t write(const uint8_t* b, size_t n) { return n; }
+  size_t write(const char* c) { return write((const uint8_t*)c, strlen(c)); }
+  size_t write(const char* c, size_t n) { return write((const uint8_t*)c, n); }
+  void print(const String&) {} void print(const char*) {} void print(int) {} void print(unsigned long) {}
+  void println(const String&) {} void println(const char*) {} void println(int) {} void println(unsigned long) {} void println() {}
+  void print(const __FlashStringHelper*) {} void println(const __FlashStringHelper*) {}
+  void printf(const char*, ...) {}
+};
+class Stream : public Print {
+public:
+  unsigned long _timeout = 1000; void setTimeout(unsigned long t) { _timeout = t; } unsigned long getTimeout() { return _timeout; }
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+  virtual int read(uint8_t* b, size_t n) { size_t i = 0; while (i < n && available()) b[i++] = read(); return i; }
+  virtual int peek() { return -1; }
+  String readStringUntil(char t) { String r; while (available()) { int c = read(); if (c == t) break; r += (char)c; } return r; }
+};
+class HardwareSerial : public Stream {};
+extern HardwareSerial Serial;
+class IPAddress {
+public:
+  uint8_t b[4] = {0,0,0,0};
+  IPAddress() {}
+  IPAddress(uint8_t a, uint8_t c, uint8_t d, uint8_t e) { b[0]=a; b[1]=c; b[2]=d; b[3]=e; }
+  bool fromString(const char* s) { unsigned x[4]; if (sscanf(s, "%u.%u.%u.%u", &x[0],&x[1],&x[2],&x[3]) != 4) return false; for (int i=0;i<4;i++) b[i]=x[i]; return true; }
+  bool fromString(const String& s) { return fromString(s.c_str()); }
+  operator uint32_t() const { return b[0] | b[1]<<8 | b[2]<<16 | (uint32_t)b[3]<<24; }
+  bool isSet() const { return (uint32_t)*this != 0; }
+  String toString() const { char t[20]; snprintf(t, 20, "%u.%u.%u.%u", b[0], b[1], b[2], b[3]); return String(t); }
+};
@@ -0,0 +1,30 @@
+#pragma once
+//Host test stand-in, only what the library uses. Not part of the Arduino build.
+#include "Arduino.h"
+#include <deque>
+
+//Socket fed by the test: rx holds the bytes the peer sent, tx collects what the library wrote
+class WiFiClient : public Stream {
+public:
+  static WiFiClient* Last; //Most recently constructed client
+  static std::string ConnectResponse; //Bytes the peer sends right after a connect
+  std::deque<uint8_t> rx; std::string tx; bool conn = false; bool connectOk = true; int connectCalls = 0; std::string lastHost;
+  size_t maxChunk = 1000000; //Bytes available() reports at most, to split reads
+  WiFiClient() { Last = this; }
+  virtual ~WiFiClient() { if (Last == this) Last = nullptr; }
+  virtual int connect(const char* host, uint16_t) { connectCalls++; lastHost = host; return onConnect(); }
+  virtual int connect(IPAddress ip, uint16_t) { connectCalls++; lastHost = ip.toString().s; return onConnect(); }
+  uint8_t connected() { return conn; }
+  void stop() { conn = false; }
+  int available() override { return std::min(rx.size(), maxChunk); }
+  int read() override { if (rx.empty()) return -1; int c = rx.front(); rx.pop_front(); return c; }
+  int read(uint8_t* b, size_t n) override { size_t i = 0; size_t lim = std::min(n, maxChunk); while (i < lim && !rx.empty()) { b[i++] = rx.front(); rx.pop_front(); } return i; }
+  int peek() override { return rx.empty() ? -1 : rx.front(); }
+  size_t write(uint8_t c) override { tx += (char)c; return 1; }
+  size_t write(const uint8_t* b, size_t n) override { tx.append((const char*)b, n); return n; }
+  using Print::write;
+  void feed(const std::string& d) { for (char c : d) rx.push_back((uint8_t)c); }
+  void setNoDelay(bool) {}
+private:
+  int onConnect() { conn = connectOk; if (conn) feed(ConnectResponse); return conn; }
+};
@@ -0,0 +1,4 @@
+#pragma once
+//Host test stand-in, only what the library uses. Not part of the Arduino build.
+#include "WiFiClient.h"
+class WiFiClientSecure : public WiFiClient { public: void setInsecure() {} };
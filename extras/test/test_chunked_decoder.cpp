@@ -0,0 +1,134 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahHTTPClient.h"
+#include "FahTestCheck.h"
+#include <cstdio>
+#include <random>
+#include <string>
+
+//Chunked body decoding of HTTPClient against a fuzzed corpus: random chunk sizes, hex case, leading zeros,
+//extensions and trailers, delivered to the client in random splits. Malformed bodies must not be reported as success.
+
+static std::mt19937 rng(1234);
+
+static int Random(int a, int b)
+{
+	return std::uniform_int_distribution<int>(a, b)(rng);
+}
+
+static std::string Hex(unsigned v, bool upper)
+{
+	char b[16];
+	snprintf(b, sizeof(b), upper ? "%X" : "%x", v);
+	return b;
+}
+
+static HTTPREQUEST_STATUS Run(const std::string& Headers, const std::string& Body, std::string& Out, const bool& CloseAtEnd)
+{
+	FahSysAPInfo info;
+	info.Hostname = "sysap";
+	FahHTTPClient client(&info);
+	WiFiClient* socket = WiFiClient::Last;
+	bool requested = client.HTTPRequestAsync("GET", "/test", "");
+	FAH_CHECK(requested);
+	client.ProcessAsync();
+
+	std::string all = Headers + Body;
+	size_t sent = 0;
+	for (int pass = 0; pass < 100000 && client.GetAsyncStatus() == HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING; pass++)
+	{
+		if (sent < all.size())
+		{
+			size_t n = Random(1, 40);
+			socket->feed(all.substr(sent, n));
+			sent += n;
+		}
+		else if (CloseAtEnd)
+		{
+			socket->conn = false;
+		}
+		else if (pass > 50000)
+		{
+			break;
+		}
+		socket->maxChunk = Random(1, 64);
+		client.ProcessAsync();
+	}
+	Out = client.GetBody().c_str();
+	return client.GetAsyncStatus();
+}
+
+static const char* ChunkedHeaders = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n";
+
+int main()
+{
+	int failed = 0;
+	for (int iter = 0; iter < 3000; iter++)
+	{
+		std::string body;
+		int length = Random(0, 1500);
+		for (int k = 0; k < length; k++)
+			body += (char)Random(32, 126);
+
+		std::string encoded;
+		size_t pos = 0;
+		while (pos < body.size())
+		{
+			size_t n = std::min<size_t>(Random(1, 300), body.size() - pos);
+			std::string size = Hex(n, Random(0, 1));
+			if (Random(0, 3) == 0)
+				size = std::string(Random(1, 3), '0') + size;
+			encoded += size;
+			if (Random(0, 4) == 0)
+				encoded += ";ext=" + std::to_string(Random(0, 99));
+			encoded += "\r\n" + body.substr(pos, n) + "\r\n";
+			pos += n;
+		}
+		encoded += "0\r\n";
+		if (Random(0, 1))
+			encoded += "X-Trailer: abc\r\nContent-Type: application/json\r\n";
+		encoded += "\r\n";
+
+		std::string out;
+		HTTPREQUEST_STATUS status = Run(ChunkedHeaders, encoded, out, false);
+		if (status != HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS || out != body.substr(0, MAXBODYSIZE))
+		{
+			printf("FAIL iteration %d: status %d, body %u of %u bytes\n", iter, status, (unsigned)out.size(), (unsigned)body.size());
+			failed++;
+		}
+	}
+
+	//Bad size lines, chunks longer than announced, oversized chunks, truncated bodies
+	const char* malformed[] = { "zz\r\nabc\r\n0\r\n\r\n", "5\r\nabcdefg\r\n0\r\n\r\n", "FFFFFFFFF\r\n", "200000\r\nabc", "3\r\nabc\r\n", "\r\n\r\n", "3\r\nab", "3;ext\r\nabcX\r\n0\r\n\r\n" };
+	for (const char* body : malformed)
+	{
+		std::string out;
+		if (Run(ChunkedHeaders, body, out, true) == HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS)
+		{
+			printf("FAIL malformed body accepted: %s\n", body);
+			failed++;
+		}
+	}
+
+	//Content-Length and close delimited bodies still work
+	std::string out;
+	if (Run("HTTP/1.1 200 OK\r\nContent-Length: 4\r\n\r\n", "abcdEXTRA", out, false) != HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS || out != "abcd")
+		failed++;
+	if (Run("HTTP/1.1 200 OK\r\n\r\n", "abcdef", out, true) != HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS || out != "abcdef")
+		failed++;
+	if (Run("HTTP/1.1 200 OK\r\nContent-Length: 10\r\n\r\n", "abc", out, true) == HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS)
+		failed++;
+
+	printf("%s, %d failures\n", failed == 0 ? "OK" : "FAILED", failed);
+	return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FreeAtHomeESPapi.h"
+#include "FahDeviceRegistry.h"
+#include "FahTestCheck.h"
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <vector>
+
+//FahDeviceRegistry against std::map under random add, remove and lookup at 64 devices,
+//followed by the lookup time per device count, printed as a benchmark, it should stay flat as the registry fills.
+
+static const uint16_t MaxDevices = 64;
+static const int IdCount = 160; //More IDs than fit, so adds are also rejected for capacity
+static const uint64_t IdBase = 0xABB700000000ULL;
+
+static std::mt19937 rng(4242);
+
+static int Random(int a, int b)
+{
+	return std::uniform_int_distribution<int>(a, b)(rng);
+}
+
+//IDs close together and IDs that only differ in the upper half, both collide on a poor hash
+static uint64_t IdOf(const int& Index)
+{
+	if (Index % 2)
+		return IdBase + Index;
+	return IdBase + ((uint64_t)Index << 32);
+}
+
+struct Registered
+{
+	FahESPDevice* Device;
+	FAH_DEVICE_HANDLE Handle;
+};
+
+static void CheckAgainstReference(FahDeviceRegistry& Registry, std::map<uint64_t, Registered>& Reference)
+{
+	FAH_CHECK(Registry.Count() == Reference.size());
+	for (auto& e : Reference)
+	{
+		FAH_CHECK(Registry.Find(e.first) == e.second.Device);
+		FAH_CHECK(Registry.GetHandle(e.first) == e.second.Handle);
+		FAH_CHECK(Registry.GetByHandle(e.second.Handle) == e.second.Device);
+	}
+	for (uint16_t i = 0; i < Registry.Count(); i++)
+	{
+		auto it = Reference.find(Registry.GetAt(i)->GetFahDeviceID());
+		FAH_CHECK(it != Reference.end() && it->second.Device == Registry.GetAt(i));
+	}
+}
+
+static void RandomOperations(std::vector<FahESPDevice*>& Pool)
+{
+	for (int round = 0; round < 50; round++)
+	{
+		FahDeviceRegistry registry(MaxDevices);
+		std::map<uint64_t, Registered> reference;
+		std::vector<FAH_DEVICE_HANDLE> removedHandles;
+
+		for (int op = 0; op < 2000; op++)
+		{
+			int kind = Random(0, 9);
+			if (kind < 5)
+			{
+				//Two devices per ID in the pool, the second one is a duplicate registration
+				FahESPDevice* device = Pool[Random(0, (int)Pool.size() - 1)];
+				FAH_DEVICE_HANDLE handle = registry.Add(device);
+				uint64_t id = device->GetFahDeviceID();
+				if (reference.count(id) != 0 || reference.size() >= MaxDevices)
+				{
+					FAH_CHECK(handle == 0);
+				}
+				else
+				{
+					FAH_CHECK(handle != 0);
+					reference[id] = Registered{ device, handle };
+				}
+			}
+			else if (kind < 8)
+			{
+				if (reference.empty())
+					continue;
+				auto it = reference.begin();
+				std::advance(it, Random(0, (int)reference.size() - 1));
+				bool removed = registry.Remove(it->second.Device);
+				FAH_CHECK(removed);
+				bool removedTwice = registry.Remove(it->second.Device);
+				FAH_CHECK(!removedTwice);
+				removedHandles.push_back(it->second.Handle);
+				reference.erase(it);
+			}
+			else
+			{
+				//Lookups of IDs that are not registered, and of handles that were released
+				uint64_t id = IdOf(Random(0, IdCount - 1));
+				if (reference.count(id) == 0)
+				{
+					FAH_CHECK(registry.Find(id) == NULL);
+					FAH_CHECK(registry.GetHandle(id) == 0);
+				}
+				if (!removedHandles.empty())
+				{
+					//Released handles never resolve again, also when their slot holds another device
+					FAH_DEVICE_HANDLE handle = removedHandles[Random(0, (int)removedHandles.size() - 1)];
+					FAH_CHECK(registry.GetByHandle(handle) == NULL);
+					for (auto& e : reference)
+						FAH_CHECK(e.second.Handle != handle);
+				}
+			}
+			CheckAgainstReference(registry, reference);
+		}
+	}
+}
+
+static double NanosecondsPerFind(std::vector<FahESPDevice*>& Pool, const uint16_t& Devices)
+{
+	FahDeviceRegistry registry(MaxDevices);
+	std::vector<uint64_t> ids;
+	for (uint16_t i = 0; i < Devices; i++)
+	{
+		FAH_DEVICE_HANDLE handle = registry.Add(Pool[i * 2]);
+		FAH_CHECK(handle != 0);
+		ids.push_back(Pool[i * 2]->GetFahDeviceID());
+	}
+
+	//Best of several runs, the host is not idle
+	double best = 1e30;
+	const int lookups = 200000;
+	for (int run = 0; run < 5; run++)
+	{
+		uintptr_t sink = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < lookups; i++)
+			sink += (uintptr_t)registry.Find(ids[i % Devices]);
+		auto end = std::chrono::steady_clock::now();
+		FAH_CHECK(sink != 0);
+		double ns = std::chrono::duration<double, std::nano>(end - start).count() / lookups;
+		if (ns < best)
+			best = ns;
+	}
+	return best;
+}
+
+int main()
+{
+	FreeAtHomeESPapi api;
+	FahSysAPInfo info;
+	std::vector<FahESPDevice*> pool;
+	for (int i = 0; i < IdCount; i++)
+	{
+		pool.push_back(new FahESPDevice("Test", IdOf(i), "Serial", 300, &api, &info));
+		pool.push_back(new FahESPDevice("Test", IdOf(i), "Serial", 300, &api, &info));
+	}
+
+	RandomOperations(pool);
+
+	//Wall clock depends on the host, only printed
+	for (uint16_t devices = 8; devices <= MaxDevices; devices *= 2)
+		printf("Find with %u devices: %.1f ns\n", devices, NanosecondsPerFind(pool, devices));
+
+	for (FahESPDevice* device : pool)
+		delete device;
+	return 0;
+}
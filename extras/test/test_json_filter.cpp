@@ -0,0 +1,142 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahJsonFilter.h"
+#include "FahTestCheck.h"
+#include <random>
+#include <string>
+
+//FahJsonFilter fed the device details in pieces of random size, the output must not depend on where the
+//document is split, and must stay small for a document that is far larger than what the paths select.
+
+static std::mt19937 rng(31);
+
+static const char* Details =
+	"{ \"00000000-0000-0000-0000-000000000000\": {\n"
+	"  \"devices\": {\n"
+	"    \"ABB700000001\": { \"displayName\": \"Other\", \"parameters\": { \"par0001\": \"9\" } },\n"
+	"    \"ABB700000002\": {\n"
+	"      \"displayName\": \"Weather \\\"roof\\\"\",\n"
+	"      \"interface\": \"vdev:installer@busch-jaeger.de\",\n"
+	"      \"unresponsive\": false,\n"
+	"      \"parameters\": { \"par0014\": \"1\", \"par0015\": [ 1, { \"a\": \"}\" } ] },\n"
+	"      \"channels\": {\n"
+	"        \"ch0000\": { \"displayName\": \"x\", \"parameters\": { \"par0020\": \"5\" }, \"inputs\": { \"idp0000\": { \"pairingID\": 1, \"value\": \"0\" } } },\n"
+	"        \"ch0001\": { \"outputs\": { \"odp0000\": { \"pairingID\": 256, \"value\": \"-1.5e3\" } }, \"parameters\": {} }\n"
+	"      }\n"
+	"    }\n"
+	"  }\n"
+	"} }\n";
+
+static const char* Expected =
+	"{\"00000000-0000-0000-0000-000000000000\":{\"devices\":{\"ABB700000002\":{"
+	"\"displayName\":\"Weather \\\"roof\\\"\","
+	"\"parameters\":{\"par0014\":\"1\",\"par0015\":[1,{\"a\":\"}\"}]},"
+	"\"channels\":{\"ch0000\":{\"parameters\":{\"par0020\":\"5\"}},\"ch0001\":{\"parameters\":{}}}}}}}";
+
+static void AddDevicePaths(FahJsonFilter& Filter)
+{
+	String device = "00000000-0000-0000-0000-000000000000/devices/ABB700000002/";
+	FAH_CHECK(Filter.AddPath(device + "displayName"));
+	FAH_CHECK(Filter.AddPath(device + "parameters"));
+	FAH_CHECK(Filter.AddPath(device + "channels/*/parameters"));
+}
+
+static bool FeedInPieces(FahJsonFilter& Filter, const std::string& Document)
+{
+	size_t pos = 0;
+	while (pos < Document.size())
+	{
+		size_t length = std::uniform_int_distribution<size_t>(1, 17)(rng);
+		if (length > Document.size() - pos)
+			length = Document.size() - pos;
+		if (!Filter.Write((const uint8_t*)Document.data() + pos, length))
+			return false;
+		pos += length;
+	}
+	return true;
+}
+
+static void SplitAnywhere()
+{
+	uint32_t hash = 0;
+	for (int round = 0; round < 200; round++)
+	{
+		FahJsonFilter filter(512);
+		AddDevicePaths(filter);
+		bool written = FeedInPieces(filter, Details);
+		FAH_CHECK(written);
+		FAH_CHECK(filter.isComplete());
+		FAH_CHECK(strcmp(filter.GetOutput().c_str(), Expected) == 0);
+		if (round > 0)
+			FAH_CHECK(filter.GetOutputHash() == hash);
+		hash = filter.GetOutputHash();
+	}
+}
+
+static void LargeDocument()
+{
+	//Many datapoints that are skipped, the output only holds the selected members
+	std::string document = "{\"00000000-0000-0000-0000-000000000000\":{\"devices\":{\"ABB700000002\":{\"channels\":{";
+	for (int i = 0; i < 1000; i++)
+	{
+		char channel[160];
+		snprintf(channel, sizeof(channel), "%s\"ch%04d\":{\"inputs\":{\"idp0000\":{\"pairingID\":1,\"value\":\"%d\"}},\"parameters\":{\"par0001\":\"%d\"}}", i ? "," : "", i, i, i % 2);
+		document += channel;
+	}
+	document += "},\"displayName\":\"Large\"}}}}";
+	FAH_CHECK(document.size() > 90000);
+
+	FahJsonFilter filter(64000);
+	AddDevicePaths(filter);
+	bool written = FeedInPieces(filter, document);
+	FAH_CHECK(written);
+	FAH_CHECK(filter.isComplete());
+	FAH_CHECK(filter.GetOutput().length() < document.size() / 2);
+	FAH_CHECK(strstr(filter.GetOutput().c_str(), "idp0000") == NULL);
+	FAH_CHECK(strstr(filter.GetOutput().c_str(), "\"ch0999\":{\"parameters\":{\"par0001\":\"1\"}}},\"displayName\":\"Large\"}") != NULL);
+
+	//The same document against an output that cannot hold the selection is rejected, not truncated
+	FahJsonFilter small(256);
+	AddDevicePaths(small);
+	bool smallWritten = FeedInPieces(small, document);
+	FAH_CHECK(!smallWritten);
+	FAH_CHECK(!small.isComplete());
+	FAH_CHECK(small.GetOutput().length() <= 256);
+}
+
+static void Rejected()
+{
+	const char* invalid[] = { "{\"a\" 1}", "{\"a\":1]", "[1,2]x", "{\"a\":}", "{} {}" };
+	for (const char* document : invalid)
+	{
+		FahJsonFilter filter(512);
+		AddDevicePaths(filter);
+		bool written = filter.Write((const uint8_t*)document, strlen(document));
+		FAH_CHECK(!written || !filter.isComplete());
+	}
+
+	//A body that ends early is not complete
+	FahJsonFilter filter(512);
+	AddDevicePaths(filter);
+	bool written = filter.Write((const uint8_t*)Details, strlen(Details) / 2);
+	FAH_CHECK(written);
+	FAH_CHECK(!filter.isComplete());
+}
+
+int main()
+{
+	SplitAnywhere();
+	LargeDocument();
+	Rejected();
+	return 0;
+}
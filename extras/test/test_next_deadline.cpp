@@ -0,0 +1,82 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FreeAtHomeESPapi.h"
+#include "FahTestCheck.h"
+#include <cstdio>
+
+//Idle sketch with a connected websocket: a loop that sleeps NextDeadlineMs() between process() calls
+//must wake up far less often than one polling every few milliseconds, and still send the websocket pings.
+
+static const unsigned long SimulatedMs = 60000;
+static const unsigned long PollIntervalMs = 10;
+
+static FreeAtHomeESPapi* Connect(WiFiClient*& Socket)
+{
+	WiFiClient::ConnectResponse = "HTTP/1.1 101 Switching Protocols\r\nConnection: Upgrade\r\nUpgrade: websocket\r\nSec-WebSocket-Accept: x\r\n\r\n";
+	FreeAtHomeESPapi* api = new FreeAtHomeESPapi();
+	bool connected = api->ConnectToSysAP("sysap", "Basic dGVzdDp0ZXN0", false);
+	FAH_CHECK(connected);
+	Socket = WiFiClient::Last;
+	FAH_CHECK(Socket != nullptr);
+	for (int i = 0; i < 10; i++)
+		api->process();
+	WiFiClient::ConnectResponse = "";
+	return api;
+}
+
+//Returns the number of process() calls in SimulatedMs, Sleep selects NextDeadlineMs() over a fixed poll interval
+static unsigned long Run(const bool& Sleep, size_t& BytesSent)
+{
+	WiFiClient* socket = nullptr;
+	FreeAtHomeESPapi* api = Connect(socket);
+	size_t sentBefore = socket->tx.size();
+
+	unsigned long wakeups = 0;
+	unsigned long end = millis() + SimulatedMs;
+	while ((long)(millis() - end) < 0)
+	{
+		api->process();
+		wakeups++;
+		FAH_CHECK(socket->conn);
+
+		unsigned long sleepMs = PollIntervalMs;
+		if (Sleep)
+		{
+			sleepMs = api->NextDeadlineMs();
+			if (sleepMs == 0)
+				sleepMs = 1;
+		}
+		delay(sleepMs);
+	}
+	BytesSent = socket->tx.size() - sentBefore;
+	delete api;
+	return wakeups;
+}
+
+int main()
+{
+	size_t polledBytes = 0;
+	size_t sleptBytes = 0;
+	unsigned long polled = Run(false, polledBytes);
+	unsigned long slept = Run(true, sleptBytes);
+	printf("Wakeups per minute: polling %lu, NextDeadlineMs %lu\n", polled, slept);
+
+	FAH_CHECK(polled >= SimulatedMs / PollIntervalMs);
+	//Only the websocket ping is due while idle, one wakeup per WS_PING_INTERVAL_TIMEOUT plus a few for the ping itself
+	FAH_CHECK(slept * 100 < polled);
+	FAH_CHECK(slept <= (SimulatedMs / WS_PING_INTERVAL_TIMEOUT + 1) * 4);
+	//Sleeping must not skip the pings
+	FAH_CHECK(sleptBytes > 0);
+	FAH_CHECK(sleptBytes == polledBytes);
+	return 0;
+}
@@ -0,0 +1,53 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahReportFilter.h"
+#include "FahTestCheck.h"
+
+//A sensor drifting within the deadband is reported by the heartbeat with its latest reading,
+//and the deadband then applies to that reading.
+
+int main()
+{
+	FahReportFilter filter(1.0f, 0, 1000, 60000);
+	FAH_CHECK(filter.Offer(20.0f, false));
+	filter.Reported(20.0f);
+
+	//0.08 per 5 seconds stays within the deadband of 1.0 until the heartbeat
+	float reading = 20.0f;
+	float value = 0;
+	for (int i = 0; i < 11; i++)
+	{
+		delay(5000);
+		reading += 0.08f;
+		bool offered = filter.Offer(reading, false);
+		FAH_CHECK(!offered);
+		bool due = filter.isDue(value);
+		FAH_CHECK(!due);
+	}
+	delay(5000);
+	reading += 0.08f;
+	bool offered = filter.Offer(reading, false);
+	FAH_CHECK(!offered);
+	bool due = filter.isDue(value);
+	FAH_CHECK(due);
+	FAH_CHECK(value == reading);
+	filter.Reported(value);
+	FAH_CHECK(filter.GetReportedValue() == reading);
+
+	//Heartbeat without any offer in between repeats the value that was sent
+	delay(60000);
+	due = filter.isDue(value);
+	FAH_CHECK(due);
+	FAH_CHECK(value == reading);
+	return 0;
+}
@@ -0,0 +1,66 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FreeAtHomeESPapi.h"
+#include "FahESPGenericDevice.h"
+#include "FahTestCheck.h"
+
+//FindDataPoint finds every datapoint of a schema and nothing else, with the binary search on a sorted
+//table and the linear search on a table that is not sorted.
+
+using namespace FAH_DATAPOINT_DIRECTIONS;
+using namespace FAH_VALUE_TYPES;
+
+static const FahDataPointSchema UnsortedDataPoints[] =
+{
+	{ 1, FAH_DP_OUTPUT, 0, FAH_VALUE_BOOL, FAH_DP_NO_FEEDBACK, false },
+	{ 0, FAH_DP_INPUT, 0, FAH_VALUE_BOOL, 0, false },
+	{ 2, FAH_DP_INPUT, 3, FAH_VALUE_UINT, FAH_DP_NO_FEEDBACK, false },
+	{ 0, FAH_DP_OUTPUT, 1, FAH_VALUE_UINT, FAH_DP_NO_FEEDBACK, false },
+};
+static const FahDeviceSchema UnsortedSchema = { "Unsorted", UnsortedDataPoints, FahSchemaCount(UnsortedDataPoints), NULL, 0 };
+
+static void CheckLookups(FreeAtHomeESPapi& Api, FahSysAPInfo& Info, const FahDeviceSchema& Schema)
+{
+	FahESPGenericDevice device(Schema, 0xABB700000001ULL, "Serial", 300, &Api, &Info);
+	for (uint8_t i = 0; i < Schema.DataPointCount; i++)
+		FAH_CHECK(device.FindDataPoint(Schema.DataPoints[i].Key()) == i);
+
+	//Every other key of the first channels, on both sides of the existing ones
+	for (uint16_t channel = 0; channel < 4; channel++)
+	{
+		for (uint16_t datapoint = 0; datapoint < 8; datapoint++)
+		{
+			for (uint8_t direction = FAH_DP_INPUT; direction <= FAH_DP_OUTPUT; direction++)
+			{
+				FAH_DATAPOINT_KEY key = FahDataPointKey(channel, (FAH_DATAPOINT_DIRECTION)direction, datapoint);
+				bool present = false;
+				for (uint8_t i = 0; i < Schema.DataPointCount; i++)
+					present = present || Schema.DataPoints[i].Key() == key;
+				if (!present)
+					FAH_CHECK(device.FindDataPoint(key) == FAH_SCHEMA_NOT_FOUND);
+			}
+		}
+	}
+}
+
+int main()
+{
+	FreeAtHomeESPapi api;
+	FahSysAPInfo info;
+	CheckLookups(api, info, FAH_SCHEMA_DIM_ACTUATOR);
+	CheckLookups(api, info, FAH_SCHEMA_BLIND_ACTUATOR);
+	CheckLookups(api, info, FAH_SCHEMA_ROOM_TEMPERATURE_CONTROLLER);
+	CheckLookups(api, info, FAH_SCHEMA_BINARY_SENSOR);
+	CheckLookups(api, info, UnsortedSchema);
+	return 0;
+}
@@ -0,0 +1,56 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include <Arduino.h>
+#include "FahESPBuildConfig.h"
+
+//Capacities of one FreeAtHomeESPapi instance, the devices it creates use the datapoint queue and body size
+struct FahCapacities
+{
+	uint8_t MaxDevices;
+	uint8_t MaxPendingCreations;
+	uint8_t MaxPendingDataPoints; //Queued datapoint requests per device
+	uint16_t JsonDocSize; //Document for websocket messages and device creation responses
+	uint16_t DeviceJsonDocSize; //Document for datapoint reads and device details of a device, also bounds the filtered details
+	uint16_t MaxBodySize; //HTTP response body bytes kept per request
+	uint16_t RequestBufferSize; //Allocated while a HTTP request is sent
+	uint8_t HeaderLineSize; //Allocated while a HTTP response is read
+	uint16_t MaxTimers;
+};
+
+//Renewal, refresh, request timeout and sensor report per device, creation timeouts and the websocket ping
+constexpr uint16_t FahTimerCapacity(uint8_t MaxDevices, uint8_t MaxPendingCreations)
+{
+	return ((uint16_t)MaxDevices * 4) + MaxPendingCreations + 1;
+}
+
+//Capacity policy with the values of FahESPBuildConfig.h
+//A deployment derives its own policy and hides the values it changes:
+//	struct SingleSwitchNode : FahDefaultCapacityPolicy { static constexpr uint8_t MaxDevices = 1; };
+//	FreeAtHomeESPapiSized<SingleSwitchNode> freeAtHomeESPapi;
+struct FahDefaultCapacityPolicy
+{
+	static constexpr uint8_t MaxDevices = MAX_ESP_CREATED_DEVICES;
+	static constexpr uint8_t MaxPendingCreations = MAX_PENDING_DEVICE_CREATIONS;
+	static constexpr uint8_t MaxPendingDataPoints = MAX_PENDING_DATAPOINTS;
+	static constexpr uint16_t JsonDocSize = MAX_ARDUINOJSON_DOC_SIZE;
+	static constexpr uint16_t DeviceJsonDocSize = MAX_DEVICE_JSON_DOC_SIZE;
+	static constexpr uint16_t MaxBodySize = MAXBODYSIZE;
+	static constexpr uint16_t RequestBufferSize = HTTP_REQUEST_BUFFER_SIZE;
+	static constexpr uint8_t HeaderLineSize = HTTP_MAX_HEADER_LINE;
+};
+
+template<class Policy> constexpr FahCapacities FahCapacitiesOf()
+{
+	return FahCapacities{ Policy::MaxDevices, Policy::MaxPendingCreations, Policy::MaxPendingDataPoints, Policy::JsonDocSize, Policy::DeviceJsonDocSize, Policy::MaxBodySize, Policy::RequestBufferSize, Policy::HeaderLineSize, FahTimerCapacity(Policy::MaxDevices, Policy::MaxPendingCreations) };
+}
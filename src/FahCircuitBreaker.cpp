@@ -0,0 +1,83 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahCircuitBreaker.h"
+
+bool FahCircuitBreaker::isConnectAllowed()
+{
+	if (State == FAH_BREAKER_STATES::FAH_BREAKER_CLOSED)
+		return true;
+	if (State == FAH_BREAKER_STATES::FAH_BREAKER_OPEN)
+		return (millis() - OpenMillis) >= OpenDurationMs;
+	return false; //Probe in progress
+}
+
+bool FahCircuitBreaker::AllowConnect()
+{
+	if (!isConnectAllowed())
+		return false;
+
+	if (State == FAH_BREAKER_STATES::FAH_BREAKER_OPEN)
+	{
+		//Let this connect through as the probe
+		DEBUG_PL(F("Breaker half open"));
+		State = FAH_BREAKER_STATES::FAH_BREAKER_HALF_OPEN;
+	}
+	return true;
+}
+
+void FahCircuitBreaker::RecordSuccess()
+{
+	if (State != FAH_BREAKER_STATES::FAH_BREAKER_CLOSED)
+	{
+		DEBUG_PL(F("Breaker closed"));
+	}
+	Reset();
+}
+
+void FahCircuitBreaker::RecordFailure()
+{
+	if (State == FAH_BREAKER_STATES::FAH_BREAKER_HALF_OPEN)
+	{
+		//Probe failed, stay open longer
+		OpenDurationMs *= 2;
+		if (OpenDurationMs > FAH_BREAKER_MAX_OPEN_MS)
+			OpenDurationMs = FAH_BREAKER_MAX_OPEN_MS;
+	}
+	else if (State == FAH_BREAKER_STATES::FAH_BREAKER_CLOSED)
+	{
+		Failures++;
+		if (Failures < FAH_BREAKER_FAILURE_THRESHOLD)
+			return;
+	}
+	DEBUG_PL(F("Breaker open"));
+	State = FAH_BREAKER_STATES::FAH_BREAKER_OPEN;
+	OpenMillis = millis();
+}
+
+void FahCircuitBreaker::Reset()
+{
+	State = FAH_BREAKER_STATES::FAH_BREAKER_CLOSED;
+	Failures = 0;
+	OpenDurationMs = FAH_BREAKER_OPEN_MS;
+}
+
+unsigned long FahCircuitBreaker::MillisUntilProbe()
+{
+	if (State != FAH_BREAKER_STATES::FAH_BREAKER_OPEN)
+		return 0;
+
+	unsigned long elapsed = millis() - OpenMillis;
+	if (elapsed >= OpenDurationMs)
+		return 0;
+	return OpenDurationMs - elapsed;
+}
@@ -0,0 +1,44 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include <Arduino.h>
+#include "FahESPBuildConfig.h"
+
+namespace FAH_BREAKER_STATES
+{
+	enum FAH_BREAKER_STATE :uint8_t
+	{
+		FAH_BREAKER_CLOSED = 0, //Connects are attempted
+		FAH_BREAKER_OPEN = 1, //Connects fail fast until the open time has passed
+		FAH_BREAKER_HALF_OPEN = 2, //One probe connect is attempted
+	};
+}
+typedef FAH_BREAKER_STATES::FAH_BREAKER_STATE FAH_BREAKER_STATE;
+
+//Shared by all connections to one endpoint, stops blocking connects while the endpoint is down
+class FahCircuitBreaker
+{
+public:
+	bool AllowConnect();
+	bool isConnectAllowed();
+	void RecordSuccess();
+	void RecordFailure();
+	void Reset();
+	unsigned long MillisUntilProbe();
+	FAH_BREAKER_STATE GetState() { return State; };
+private:
+	FAH_BREAKER_STATE State = FAH_BREAKER_STATES::FAH_BREAKER_CLOSED;
+	uint8_t Failures = 0;
+	unsigned long OpenMillis = 0;
+	unsigned long OpenDurationMs = FAH_BREAKER_OPEN_MS;
+};
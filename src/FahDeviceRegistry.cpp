@@ -0,0 +1,207 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahDeviceRegistry.h"
+#include "FahESPDevice.h"
+
+#define HANDLE_FREE 0xFFFF
+#define HANDLE_SLOT_MASK 0xFFFF
+#define HANDLE_GENERATION_SHIFT 16
+
+FahDeviceRegistry::~FahDeviceRegistry()
+{
+	//The devices themselves are owned by the api
+	if (Devices != NULL)
+		delete[] Devices;
+	if (HandleToIndex != NULL)
+		delete[] HandleToIndex;
+	if (HandleGeneration != NULL)
+		delete[] HandleGeneration;
+	if (IdIndex != NULL)
+		delete[] IdIndex;
+}
+
+uint16_t FahDeviceRegistry::GetIdSlot(const uint64_t& FahID)
+{
+	//Mix both halves of the ID, the upper part is mostly the same for all virtual devices
+	uint32_t hash = (uint32_t)FahID ^ (uint32_t)(FahID >> 32);
+	hash *= 0x9E3779B1UL;
+	return (hash >> 16) & (IdIndexSize - 1);
+}
+
+int32_t FahDeviceRegistry::FindIdSlot(const uint64_t& FahID)
+{
+	if (IdIndexSize == 0)
+		return -1;
+
+	uint16_t slot = GetIdSlot(FahID);
+	while (IdIndex[slot] != 0)
+	{
+		if (Devices[IdIndex[slot] - 1].FahID == FahID)
+			return slot;
+		slot = (slot + 1) & (IdIndexSize - 1);
+	}
+	return -1;
+}
+
+void FahDeviceRegistry::InsertId(const uint64_t& FahID, const uint16_t& Index)
+{
+	uint16_t slot = GetIdSlot(FahID);
+	while (IdIndex[slot] != 0)
+	{
+		slot = (slot + 1) & (IdIndexSize - 1);
+	}
+	IdIndex[slot] = Index + 1;
+}
+
+void FahDeviceRegistry::RemoveIdSlot(uint16_t Slot)
+{
+	//Backward shift deletion, keeps the probe sequences intact without tombstones
+	uint16_t mask = IdIndexSize - 1;
+	IdIndex[Slot] = 0;
+	uint16_t next = (Slot + 1) & mask;
+	while (IdIndex[next] != 0)
+	{
+		uint16_t home = GetIdSlot(Devices[IdIndex[next] - 1].FahID);
+		//Move the entry into the hole when its home slot is not between the hole and its position
+		if (((next - home) & mask) >= ((next - Slot) & mask))
+		{
+			IdIndex[Slot] = IdIndex[next];
+			IdIndex[next] = 0;
+			Slot = next;
+		}
+		next = (next + 1) & mask;
+	}
+}
+
+bool FahDeviceRegistry::Grow()
+{
+	uint16_t newCapacity = Capacity == 0 ? FAH_DEVICE_REGISTRY_INITIAL_CAPACITY : Capacity * 2;
+	if (newCapacity > MaxCapacity)
+		newCapacity = MaxCapacity;
+	if (newCapacity <= Capacity)
+		return false;
+
+	RegistryEntry* newDevices = new RegistryEntry[newCapacity];
+	uint16_t* newHandleToIndex = new uint16_t[newCapacity];
+	uint16_t* newHandleGeneration = new uint16_t[newCapacity];
+	for (uint16_t i = 0; i < newCapacity; i++)
+	{
+		if (i < DeviceCount)
+			newDevices[i] = Devices[i];
+		newHandleToIndex[i] = i < Capacity ? HandleToIndex[i] : HANDLE_FREE;
+		newHandleGeneration[i] = i < Capacity ? HandleGeneration[i] : 0;
+	}
+	if (Devices != NULL)
+		delete[] Devices;
+	if (HandleToIndex != NULL)
+		delete[] HandleToIndex;
+	if (HandleGeneration != NULL)
+		delete[] HandleGeneration;
+	Devices = newDevices;
+	HandleToIndex = newHandleToIndex;
+	HandleGeneration = newHandleGeneration;
+	Capacity = newCapacity;
+
+	//Index at most half full, rebuilt at the new size
+	uint16_t newIndexSize = 4;
+	while (newIndexSize < Capacity * 2)
+		newIndexSize *= 2;
+	if (newIndexSize != IdIndexSize)
+	{
+		if (IdIndex != NULL)
+			delete[] IdIndex;
+		IdIndexSize = newIndexSize;
+		IdIndex = new uint16_t[IdIndexSize];
+		memset(IdIndex, 0, IdIndexSize * sizeof(uint16_t));
+		for (uint16_t i = 0; i < DeviceCount; i++)
+			InsertId(Devices[i].FahID, i);
+	}
+	return true;
+}
+
+FAH_DEVICE_HANDLE FahDeviceRegistry::Add(FahESPDevice* Device)
+{
+	if (Device == NULL || FindIdSlot(Device->GetFahDeviceID()) >= 0)
+		return 0;
+	if (DeviceCount == Capacity && !Grow())
+		return 0;
+
+	uint16_t handleSlot = 0;
+	while (HandleToIndex[handleSlot] != HANDLE_FREE)
+		handleSlot++;
+
+	RegistryEntry& entry = Devices[DeviceCount];
+	entry.Device = Device;
+	entry.FahID = Device->GetFahDeviceID();
+	entry.Handle = ((FAH_DEVICE_HANDLE)HandleGeneration[handleSlot] << HANDLE_GENERATION_SHIFT) | (handleSlot + 1);
+	HandleToIndex[handleSlot] = DeviceCount;
+	InsertId(entry.FahID, DeviceCount);
+	DeviceCount++;
+	return entry.Handle;
+}
+
+bool FahDeviceRegistry::Remove(FahESPDevice* Device)
+{
+	if (Device == NULL)
+		return false;
+
+	int32_t slot = FindIdSlot(Device->GetFahDeviceID());
+	if (slot < 0 || Devices[IdIndex[slot] - 1].Device != Device)
+		return false;
+
+	uint16_t index = IdIndex[slot] - 1;
+	RemoveIdSlot(slot);
+	uint16_t handleSlot = (Devices[index].Handle & HANDLE_SLOT_MASK) - 1;
+	HandleToIndex[handleSlot] = HANDLE_FREE;
+	//Handles given out for this device do not match the slot anymore
+	HandleGeneration[handleSlot]++;
+
+	//Keep the devices dense, the last one takes the free place
+	DeviceCount--;
+	if (index != DeviceCount)
+	{
+		Devices[index] = Devices[DeviceCount];
+		HandleToIndex[(Devices[index].Handle & HANDLE_SLOT_MASK) - 1] = index;
+		IdIndex[FindIdSlot(Devices[index].FahID)] = index + 1;
+	}
+	Devices[DeviceCount] = RegistryEntry();
+	return true;
+}
+
+FahESPDevice* FahDeviceRegistry::Find(const uint64_t& FahID)
+{
+	int32_t slot = FindIdSlot(FahID);
+	if (slot < 0)
+		return NULL;
+	return Devices[IdIndex[slot] - 1].Device;
+}
+
+FAH_DEVICE_HANDLE FahDeviceRegistry::GetHandle(const uint64_t& FahID)
+{
+	int32_t slot = FindIdSlot(FahID);
+	if (slot < 0)
+		return 0;
+	return Devices[IdIndex[slot] - 1].Handle;
+}
+
+FahESPDevice* FahDeviceRegistry::GetByHandle(const FAH_DEVICE_HANDLE& Handle)
+{
+	uint16_t handleSlot = Handle & HANDLE_SLOT_MASK;
+	if (handleSlot == 0 || handleSlot > Capacity || HandleToIndex[handleSlot - 1] == HANDLE_FREE)
+		return NULL;
+	//Slot reused by another device after the handle's device was removed
+	RegistryEntry& entry = Devices[HandleToIndex[handleSlot - 1]];
+	if (entry.Handle != Handle)
+		return NULL;
+	return entry.Device;
+}
@@ -0,0 +1,56 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include <Arduino.h>
+#include "FahESPBuildConfig.h"
+
+class FahESPDevice;
+
+typedef uint32_t FAH_DEVICE_HANDLE; //0 is no device, slot + 1 in the low 16 bits and the slot generation in the high 16 bits
+
+//Growable set of the virtual devices of the api
+//Devices are kept dense for iteration, looked up by FaH ID through an open addressing index
+//and by handle, which stays the same while the device is registered and does not resolve to another device once it is removed
+class FahDeviceRegistry
+{
+public:
+	FahDeviceRegistry(const uint16_t& MaxCapacity) :MaxCapacity(MaxCapacity) {};
+	~FahDeviceRegistry();
+	FAH_DEVICE_HANDLE Add(FahESPDevice* Device);
+	bool Remove(FahESPDevice* Device);
+	FahESPDevice* Find(const uint64_t& FahID);
+	FahESPDevice* GetByHandle(const FAH_DEVICE_HANDLE& Handle);
+	FAH_DEVICE_HANDLE GetHandle(const uint64_t& FahID);
+	FahESPDevice* GetAt(const uint16_t& Index) { return Devices[Index].Device; };
+	uint16_t Count() { return DeviceCount; };
+private:
+	struct RegistryEntry
+	{
+		FahESPDevice* Device = NULL;
+		uint64_t FahID = 0;
+		FAH_DEVICE_HANDLE Handle = 0;
+	};
+	RegistryEntry* Devices = NULL;
+	uint16_t DeviceCount = 0;
+	uint16_t Capacity = 0;
+	uint16_t MaxCapacity = 0; //Capacity does not grow beyond this
+	uint16_t* HandleToIndex = NULL; //Per handle slot the index in Devices, or HANDLE_FREE
+	uint16_t* HandleGeneration = NULL; //Per handle slot, incremented when its device is removed
+	uint16_t* IdIndex = NULL; //Open addressing on FaH ID, index in Devices + 1, 0 is empty
+	uint16_t IdIndexSize = 0;
+	bool Grow();
+	uint16_t GetIdSlot(const uint64_t& FahID);
+	int32_t FindIdSlot(const uint64_t& FahID);
+	void InsertId(const uint64_t& FahID, const uint16_t& Index);
+	void RemoveIdSlot(uint16_t Slot);
+};
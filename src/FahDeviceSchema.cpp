@@ -0,0 +1,83 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahDeviceSchema.h"
+
+using namespace FAH_DATAPOINT_DIRECTIONS;
+using namespace FAH_VALUE_TYPES;
+
+//Index in the datapoint table, used for the feedback of inputs
+namespace DIM_DP { enum :uint8_t { IN_ON_OFF, IN_RELATIVE, IN_ABSOLUTE, OUT_ON_OFF, OUT_VALUE }; }
+static constexpr FahDataPointSchema DimActuatorDataPoints[] =
+{
+	{ 0, FAH_DP_INPUT, 0, FAH_VALUE_BOOL, DIM_DP::OUT_ON_OFF, false }, //Switch on/off
+	{ 0, FAH_DP_INPUT, 1, FAH_VALUE_UINT, FAH_DP_NO_FEEDBACK, false }, //Relative set value
+	{ 0, FAH_DP_INPUT, 2, FAH_VALUE_UINT, DIM_DP::OUT_VALUE, false }, //Absolute set value
+	{ 0, FAH_DP_OUTPUT, 0, FAH_VALUE_BOOL, FAH_DP_NO_FEEDBACK, true }, //Info on/off
+	{ 0, FAH_DP_OUTPUT, 1, FAH_VALUE_UINT, FAH_DP_NO_FEEDBACK, true }, //Info actual dim value
+};
+static_assert(FahIsSortedByKey(DimActuatorDataPoints), "DimActuatorDataPoints must be sorted by Key()");
+static constexpr FahParameterSchema DimActuatorParameters[] =
+{
+	{ 0, PID_DIMMING_ACTUATOR_MIN_BRIGHTNESS },
+	{ 0, PID_DIMMING_ACTUATOR_MAX_BRIGHTNESS_DAY },
+	{ 0, PID_DIMMING_ACTUATOR_MAX_BRIGHTNESS_NIGHT },
+};
+const FahDeviceSchema FAH_SCHEMA_DIM_ACTUATOR = { "DimActuator", DimActuatorDataPoints, FahSchemaCount(DimActuatorDataPoints), DimActuatorParameters, FahSchemaCount(DimActuatorParameters) };
+
+namespace BLIND_DP { enum :uint8_t { IN_MOVE, IN_STOP, IN_POSITION, OUT_MOVE, OUT_POSITION }; }
+static constexpr FahDataPointSchema BlindActuatorDataPoints[] =
+{
+	{ 0, FAH_DP_INPUT, 0, FAH_VALUE_BOOL, BLIND_DP::OUT_MOVE, false }, //Move up/down
+	{ 0, FAH_DP_INPUT, 1, FAH_VALUE_BOOL, FAH_DP_NO_FEEDBACK, false }, //Stop / step
+	{ 0, FAH_DP_INPUT, 2, FAH_VALUE_UINT, BLIND_DP::OUT_POSITION, false }, //Set absolute position
+	{ 0, FAH_DP_OUTPUT, 0, FAH_VALUE_BOOL, FAH_DP_NO_FEEDBACK, false }, //Info move up/down
+	{ 0, FAH_DP_OUTPUT, 1, FAH_VALUE_UINT, FAH_DP_NO_FEEDBACK, true }, //Info current position
+};
+static_assert(FahIsSortedByKey(BlindActuatorDataPoints), "BlindActuatorDataPoints must be sorted by Key()");
+static constexpr FahParameterSchema BlindActuatorParameters[] =
+{
+	{ 0, PID_TOTAL_BLINDS_MOVEMENT_TIME },
+	{ 0, PID_TOTAL_BLINDS_MOVEMENT_TIME_DOWN },
+};
+const FahDeviceSchema FAH_SCHEMA_BLIND_ACTUATOR = { "BlindActuator", BlindActuatorDataPoints, FahSchemaCount(BlindActuatorDataPoints), BlindActuatorParameters, FahSchemaCount(BlindActuatorParameters) };
+
+namespace RTC_DP { enum :uint8_t { IN_ON_OFF, IN_SETPOINT, OUT_ON_OFF, OUT_SETPOINT, OUT_TEMPERATURE }; }
+static constexpr FahDataPointSchema RoomTemperatureControllerDataPoints[] =
+{
+	{ 0, FAH_DP_INPUT, 0, FAH_VALUE_BOOL, RTC_DP::OUT_ON_OFF, false }, //Controller on/off request
+	{ 0, FAH_DP_INPUT, 1, FAH_VALUE_FLOAT, RTC_DP::OUT_SETPOINT, false }, //Set point temperature request
+	{ 0, FAH_DP_OUTPUT, 0, FAH_VALUE_BOOL, FAH_DP_NO_FEEDBACK, true }, //Info controller on/off
+	{ 0, FAH_DP_OUTPUT, 1, FAH_VALUE_FLOAT, FAH_DP_NO_FEEDBACK, true }, //Info set point temperature
+	{ 0, FAH_DP_OUTPUT, 2, FAH_VALUE_FLOAT, FAH_DP_NO_FEEDBACK, false }, //Measured temperature
+};
+static_assert(FahIsSortedByKey(RoomTemperatureControllerDataPoints), "RoomTemperatureControllerDataPoints must be sorted by Key()");
+static constexpr FahParameterSchema RoomTemperatureControllerParameters[] =
+{
+	{ 0, PID_DEFAULT_SETPOINT_TEMPERATURE },
+	{ 0, PID_ECO_DELTA_TEMPERATURE },
+	{ 0, PID_TEMPERATURE_CORRECTION },
+	{ 0, PID_MAX_TEMP_ADJ },
+	{ 0, PID_MIN_TEMP_ADJ },
+};
+const FahDeviceSchema FAH_SCHEMA_ROOM_TEMPERATURE_CONTROLLER = { "RTC", RoomTemperatureControllerDataPoints, FahSchemaCount(RoomTemperatureControllerDataPoints), RoomTemperatureControllerParameters, FahSchemaCount(RoomTemperatureControllerParameters) };
+
+static constexpr FahDataPointSchema BinarySensorDataPoints[] =
+{
+	{ 0, FAH_DP_OUTPUT, 0, FAH_VALUE_BOOL, FAH_DP_NO_FEEDBACK, false }, //Switch on/off
+};
+static_assert(FahIsSortedByKey(BinarySensorDataPoints), "BinarySensorDataPoints must be sorted by Key()");
+static constexpr FahParameterSchema BinarySensorParameters[] =
+{
+	{ 0, PID_BI_CONTACT_TYPE },
+};
+const FahDeviceSchema FAH_SCHEMA_BINARY_SENSOR = { "BinarySensor", BinarySensorDataPoints, FahSchemaCount(BinarySensorDataPoints), BinarySensorParameters, FahSchemaCount(BinarySensorParameters) };
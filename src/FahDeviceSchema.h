@@ -0,0 +1,86 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include <Arduino.h>
+#include "FahParamDefinitions.h"
+
+namespace FAH_VALUE_TYPES
+{
+	enum FAH_VALUE_TYPE :uint8_t
+	{
+		FAH_VALUE_BOOL = 0, //Sent as 0 or 1
+		FAH_VALUE_UINT = 1, //Percentage, position or counter
+		FAH_VALUE_FLOAT = 2, //Sent with two decimals
+	};
+}
+typedef FAH_VALUE_TYPES::FAH_VALUE_TYPE FAH_VALUE_TYPE;
+
+namespace FAH_DATAPOINT_DIRECTIONS
+{
+	enum FAH_DATAPOINT_DIRECTION :uint8_t
+	{
+		FAH_DP_INPUT = 0, //idp, written by the SysAP
+		FAH_DP_OUTPUT = 1, //odp, written by the device
+	};
+}
+typedef FAH_DATAPOINT_DIRECTIONS::FAH_DATAPOINT_DIRECTION FAH_DATAPOINT_DIRECTION;
+
+#define FAH_DP_NO_FEEDBACK 0xFF
+
+typedef uint32_t FAH_DATAPOINT_KEY;
+
+//Channel, direction and datapoint number in one value, usable as case label, for every channel 0x00 to 0xFF
+constexpr FAH_DATAPOINT_KEY FahDataPointKey(const uint8_t Channel, const FAH_DATAPOINT_DIRECTION Direction, const uint8_t DataPoint)
+{
+	return ((FAH_DATAPOINT_KEY)Channel << 9) | ((FAH_DATAPOINT_KEY)Direction << 8) | DataPoint;
+}
+
+struct FahDataPointSchema
+{
+	uint8_t Channel;
+	FAH_DATAPOINT_DIRECTION Direction;
+	uint8_t DataPoint;
+	FAH_VALUE_TYPE ValueType;
+	uint8_t Feedback; //Index of the output datapoint that reports a received input value, FAH_DP_NO_FEEDBACK for none
+	bool ReadOnReconnect; //Output datapoint is read back from the SysAP after (re)connecting
+	constexpr FAH_DATAPOINT_KEY Key() const { return FahDataPointKey(Channel, Direction, DataPoint); }
+};
+
+struct FahParameterSchema
+{
+	uint8_t Channel;
+	uint16_t Parameter; //PID_ value from FahParamDefinitions.h
+};
+
+struct FahDeviceSchema
+{
+	const char* DeviceType; //Virtual device type as registered at the SysAP
+	const FahDataPointSchema* DataPoints; //Sorted by Key() for a binary search, other tables are searched linearly
+	uint8_t DataPointCount;
+	const FahParameterSchema* Parameters;
+	uint8_t ParameterCount;
+};
+
+template<typename T, uint8_t N> constexpr uint8_t FahSchemaCount(const T(&)[N]) { return N; }
+
+//Compile time check that a datapoint table is sorted by Key(), for use in static_assert
+template<size_t N> constexpr bool FahIsSortedByKey(const FahDataPointSchema(&Table)[N], const size_t Index = 1)
+{
+	return Index >= N || (Table[Index - 1].Key() < Table[Index].Key() && FahIsSortedByKey(Table, Index + 1));
+}
+
+//Schemas of the virtual device types that are declared by the library
+extern const FahDeviceSchema FAH_SCHEMA_DIM_ACTUATOR;
+extern const FahDeviceSchema FAH_SCHEMA_BLIND_ACTUATOR;
+extern const FahDeviceSchema FAH_SCHEMA_ROOM_TEMPERATURE_CONTROLLER;
+extern const FahDeviceSchema FAH_SCHEMA_BINARY_SENSOR;
@@ -15,10 +15,45 @@
 
 //#define DEBUG
 //#define FORCE_ESP8266_SSL_OPTION_AVAILBLE
-#define MAX_ESP_CREATED_DEVICES 10
+//Capacities below are the defaults of FahDefaultCapacityPolicy, an instance can be sized with its own policy, see FahCapacityPolicy.h
+#ifdef ESP32
+#define MAX_ESP_CREATED_DEVICES 64 //Upper limit, memory for the device registry is only allocated for devices that are created
+#else
+#define MAX_ESP_CREATED_DEVICES 10 //Upper limit, memory for the device registry is only allocated for devices that are created
+#endif
+#define FAH_DEVICE_REGISTRY_INITIAL_CAPACITY 4 //Devices the registry holds before it grows, doubles when full
+#define MAX_PENDING_DEVICE_CREATIONS 4
 #define WS_PING_INTERVAL_TIMEOUT	  20000
 #define MAX_ARDUINOJSON_DOC_SIZE 10000
+#define MAX_DEVICE_JSON_DOC_SIZE 3000 //Document for datapoint reads and the filtered device details of one device
+#define MAX_PENDING_DATAPOINTS 10 //Queued datapoint requests per device
+#define MAXBODYSIZE 2048 //HTTP response body bytes kept per request
+#define HTTP_REQUEST_BUFFER_SIZE 512 //Request is serialized in this buffer while it is sent, larger requests are sent in parts
+#define HTTP_MAX_HEADER_LINE 128 //Status, header and chunk size lines, longer lines are truncated
 #define HTTP_SESSION_TIMEOUT_MS 20000 //20 seconds session timeout for http requests
+#define FAH_REQUEST_RATE_PER_SECOND 10 //REST requests per second for all devices together, 0 disables the limit
+#define FAH_REQUEST_BURST 5 //REST requests that may be sent back to back after an idle period
+#define FAH_REQUEST_FAILURE_HOLDOFF_MS 2000 //Wait time for a device after a failed or timed out request
+#define FAH_PRIORITY_STARVATION_MS 5000 //Lower priority requests waiting longer than this are sent before higher ones
+#define FAH_RETRY_MAX_ATTEMPTS 5 //Attempts for a datapoint request before it is reported with FAHESPAPI_ON_REQUEST_DEADLETTER
+#define FAH_RETRY_BACKOFF_BASE_MS 1000 //Retry delay after the first failure, doubles with every attempt
+#define FAH_RETRY_BACKOFF_MAX_MS 60000 //Upper bound of the retry delay
+#define FAH_SYSAP_ADDRESS_TTL_MS 3600000 //Resolved SysAP address is reused for one hour unless a connect fails
+#define FAH_BREAKER_FAILURE_THRESHOLD 3 //Failed SysAP connects in a row before connects fail fast
+#define FAH_BREAKER_OPEN_MS 5000 //Time connects fail fast before one probe connect is let through
+#define FAH_BREAKER_MAX_OPEN_MS 60000 //The open time doubles after every failed probe up to this value
+#define FAH_RENEWAL_JITTER_PERCENT 15 //Registration renewals are spread over the last part of the renewal interval
+#define FAH_MAX_PREEMPTIONS 3 //Times a renewal or parameter refresh may be aborted for a datapoint write before it is left to complete
+#define FAH_WS_MIN_REPORT_INTERVAL_MS 5000 //Weather station values are not sent more often than this, unless forced
+#define FAH_WS_HEARTBEAT_INTERVAL_MS 900000 //Weather station values are sent again after 15 minutes without change, 0 disables
+#define FAH_WS_TEMPERATURE_DEADBAND 0.2 //Degrees Celsius
+#define FAH_WS_BRIGHTNESS_DEADBAND 0.05 //Fraction of the last sent brightness
+#define FAH_WS_RAIN_DEADBAND 0.1
+#define FAH_WS_WIND_GUST_DEADBAND 0.5 //Meters per second
+#define FAH_WS_PUBLISH_INTERVAL_MS 10000 //FahWeatherAggregator sends the aggregate of the samples once per interval
+#define FAH_GUST_AVERAGE_SAMPLES 3 //Wind speed samples averaged for the gust peak
+#define FAH_WS_TEMPERATURE_ALARM_HYSTERESIS 1 //Frost alarm clears this many degrees above the activation level
+#define FAH_WS_WIND_ALARM_HYSTERESIS 1 //Wind alarm clears this many Beaufort below the activation level
 //#define CHECK_WIFI_CONNECTION_BEFORE_SEND  //Not implemented
 
 //Shared function defines
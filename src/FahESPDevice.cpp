@@ -12,8 +12,9 @@
 **************************************************************************************************************/
 #include "FahESPDevice.h"
 #include "FreeAtHomeESPapi.h"
+#include "FahHash.h"
 
-bool FahESPDevice::EnqueDataPoint(const bool& GetValue, const String Channel, const String DataPoint, const String Value)
+bool FahESPDevice::EnqueDataPoint(const bool& GetValue, const String Channel, const String DataPoint, const String Value, FAHESP_DATAPOINT_CALLBACK Callback, void* Context)
 {
 	String reqType = String(F("GET"));
 	if (!GetValue)
@@ -22,62 +23,107 @@ bool FahESPDevice::EnqueDataPoint(const bool& GetValue, const String Channel, co
 	String sDeviceID = GetDeviceIDAsString();
 	String Entry = reqType + ":" + sDeviceID + "." + Channel + "." + DataPoint + ":" + Value;
 	//DEBUG_PL(Entry.c_str());
-	return EnqueSetDataPoint(Entry);
+	return EnqueSetDataPoint(Entry, Callback, Context);
 }
 
-bool FahESPDevice::EnqueSetDataPoint(const String Channel, const String DataPoint, const String Value)
+bool FahESPDevice::EnqueSetDataPoint(const String Channel, const String DataPoint, const String Value, FAHESP_DATAPOINT_CALLBACK Callback, void* Context)
 {
-	return EnqueDataPoint(false, Channel, DataPoint, Value);
+	return EnqueDataPoint(false, Channel, DataPoint, Value, Callback, Context);
 }
 
-bool FahESPDevice::EnqueGetDataPoint(const String Channel, const String DataPoint)
+bool FahESPDevice::EnqueGetDataPoint(const String Channel, const String DataPoint, FAHESP_DATAPOINT_CALLBACK Callback, void* Context)
 {
-	return EnqueDataPoint(true, Channel, DataPoint, "");
+	return EnqueDataPoint(true, Channel, DataPoint, "", Callback, Context);
 }
 
 void FahESPDevice::NotifyOnSysAPReconnect()
 {	
 }
 
-bool FahESPDevice::EnqueSetDataPoint(const String Entry)
+bool FahESPDevice::EnqueSetDataPoint(const String Entry, FAHESP_DATAPOINT_CALLBACK Callback, void* Context)
 {
-	if (PendingDataPointsCount == MAX_PENDING_DATAPOINTS)
-		return false;
-
-	PendingDataPointsCount++;
-
-	String* newStrArray = new String[PendingDataPointsCount];
-	for (uint8_t i = 0; i < PendingDataPointsCount - 1; i++)
+	//Writes are user visible, reads only refresh the known state
+	FahQueuedDataPoint dataPoint;
+	dataPoint.Entry = Entry;
+	dataPoint.Priority = FAH_REQUEST_PRIORITIES::FAH_PRIORITY_INTERACTIVE;
+	if (Entry.startsWith(F("GET")))
+		dataPoint.Priority = FAH_REQUEST_PRIORITIES::FAH_PRIORITY_STATE;
+	dataPoint.EnqueuedMillis = millis();
+	dataPoint.EligibleMillis = dataPoint.EnqueuedMillis;
+	dataPoint.Callback = Callback;
+	dataPoint.Context = Context;
+
+	if (dataPoint.Priority == FAH_REQUEST_PRIORITIES::FAH_PRIORITY_INTERACTIVE)
 	{
-		newStrArray[i] = PendingDataPoints[i]; //Copy all items in the new array
+		//A newer value replaces the write that is still queued or backing off, writes to a datapoint are never acknowledged out of order
+		int16_t index = FindQueuedWrite(Entry);
+		if (index >= 0)
+		{
+			FahQueuedDataPoint superseded = PendingDataPoints[index];
+			dataPoint.EligibleMillis = superseded.EligibleMillis;
+			PendingDataPoints[index] = dataPoint;
+			Metrics.Superseded++;
+			NotifyDataPointCompleted(superseded, HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUPERSEDED, 0, "");
+			return true;
+		}
 	}
-	newStrArray[PendingDataPointsCount - 1] = Entry; //Append new item to the end
+	return EnqueDataPointEntry(dataPoint, false);
+}
 
-	if (PendingDataPoints != NULL)
-		delete[] PendingDataPoints;
+bool FahESPDevice::EnqueDataPointEntry(const FahQueuedDataPoint& DataPoint, const bool& AtFront)
+{
+	if (PendingDataPointsCount >= MaxPendingDataPoints)
+		return false;
 
-	PendingDataPoints = newStrArray;
+	uint8_t index = PendingDataPointsCount;
+	if (AtFront)
+	{
+		for (; index > 0; index--)
+		{
+			PendingDataPoints[index] = PendingDataPoints[index - 1]; //Move all items 1 down
+		}
+	}
+	PendingDataPoints[index] = DataPoint;
+	PendingDataPointsCount++;
 	return true;
 }
 
-String FahESPDevice::DequeDataPoint()
+void FahESPDevice::DequeDataPoint(const uint8_t& Index, FahQueuedDataPoint& DataPoint)
 {
-	if (PendingDataPointsCount == 0)
-		return "";
+	DataPoint = PendingDataPoints[Index];
 
 	PendingDataPointsCount--;
+	for (uint8_t i = Index; i < PendingDataPointsCount; i++)
+	{
+		PendingDataPoints[i] = PendingDataPoints[i + 1]; //Move all items 1 up
+	}
+	PendingDataPoints[PendingDataPointsCount].Entry = "";
+}
 
-	String* newStrArray = new String[PendingDataPointsCount];
-	String returnStr = "" + PendingDataPoints[0]; //Get first item from list
-
+int16_t FahESPDevice::FindQueuedDataPoint(const FAH_REQUEST_PRIORITY& Priority)
+{
+	//Oldest entry of the class that is not backing off, the queue is kept in arrival order
+	unsigned long now = millis();
 	for (uint8_t i = 0; i < PendingDataPointsCount; i++)
 	{
-		newStrArray[i] = PendingDataPoints[i + 1]; //Move all items 1 up in the new array
-	}	
+		if (PendingDataPoints[i].Priority == Priority && (long)(now - PendingDataPoints[i].EligibleMillis) >= 0)
+			return i;
+	}
+	return -1;
+}
 
-	delete[] PendingDataPoints;
-	PendingDataPoints = newStrArray;
-	return returnStr;
+int16_t FahESPDevice::FindQueuedWrite(const String& Entry)
+{
+	//Entry up to the value separator identifies the channel and datapoint
+	int target = Entry.indexOf(':', Entry.indexOf(':') + 1);
+	if (target < 0)
+		return -1;
+	for (uint8_t i = 0; i < PendingDataPointsCount; i++)
+	{
+		if (PendingDataPoints[i].Priority == FAH_REQUEST_PRIORITIES::FAH_PRIORITY_INTERACTIVE && strncmp(PendingDataPoints[i].Entry.c_str(), Entry.c_str(), target + 1) == 0)
+			return i;
+	}
+	return -1;
 }
 
 void FahESPDevice::NotifyFahDataPoint(const String& strChannel, const String& strDataPoint, const String& strValue, const bool& isSceneOrGetValue)
@@ -91,28 +137,55 @@ uint64_t FahESPDevice::GetFahDeviceID()
 
 FahESPDevice::FahESPDevice(const String& FahDeviceType, const uint64_t& FahAbbID, const String& SerialNr, const uint16_t& timeout, FreeAtHomeESPapi* fahParent, FahSysAPInfo* SysApInfo)
 {
-	this->httpclt = new FahHTTPClient(SysApInfo);
+	this->httpclt = new FahHTTPClient(SysApInfo, fahParent->GetCapacities());
+	this->MaxPendingDataPoints = fahParent->GetCapacities().MaxPendingDataPoints;
+	this->PendingDataPoints = new FahQueuedDataPoint[MaxPendingDataPoints];
 	this->SysApApi = fahParent;
 	this->FahDevice = FahAbbID;
 	this->TimeOut = timeout;
 	this->FahDeviceType = FahDeviceType;
 	this->SerialNr = SerialNr;
 	this->LastWaitInterval = millis();
+	this->ParameterRefreshDueSince = this->LastWaitInterval;
 	this->WaitTimeMs = (timeout * 3000) / 4;
+	ScheduleRenewal();
 }
 
 FahESPDevice::~FahESPDevice()
 {
+	SysApApi->GetTimerQueue().CancelAll(this);
+
+	//Requests that will not be sent anymore still complete, so a callback can release its context
+	//The derived device is gone already, only the callbacks are called and no new requests are accepted
+	MaxPendingDataPoints = 0;
+	if (InFlightPriority <= FAH_REQUEST_PRIORITIES::FAH_PRIORITY_STATE)
+	{
+		FahQueuedDataPoint inFlight = InFlightDataPoint;
+		CompleteInFlight();
+		NotifyDataPointCompleted(inFlight, HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED, 0, "");
+	}
+	while (PendingDataPointsCount > 0)
+	{
+		FahQueuedDataPoint pending;
+		DequeDataPoint(0, pending);
+		NotifyDataPointCompleted(pending, HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED, 0, "");
+	}
+
 	if (httpclt != NULL)
 	{
 		delete httpclt;
 		httpclt = NULL;
 	}
+	if (PendingDataPoints != NULL)
+	{
+		delete[] PendingDataPoints;
+		PendingDataPoints = NULL;
+	}
 }
 
 String FahESPDevice::ProcessJsonFromResponse(const String &Response)
 {
-	DynamicJsonDocument fahJsonMsg(3000);
+	DynamicJsonDocument fahJsonMsg(SysApApi->GetCapacities().DeviceJsonDocSize);
 	DeserializationError error = deserializeJson(fahJsonMsg, Response);
 
 	if (error)
@@ -122,85 +195,141 @@ String FahESPDevice::ProcessJsonFromResponse(const String &Response)
 		//DEBUG_PL(Response);
 		return "";
 	}
-	else
+	return ProcessJsonDocument(fahJsonMsg);
+}
+
+void FahESPDevice::ProcessDetails()
+{
+	if (!DetailsFilter->isComplete())
+	{
+		DEBUG_PL(F("Device details incomplete"));
+		return;
+	}
+
+	//Same details as the previous refresh, nothing to dispatch
+	uint32_t hash = DetailsFilter->GetOutputHash();
+	if (hash == LastDetailsHash)
+		return;
+
+	DynamicJsonDocument fahJsonMsg(SysApApi->GetCapacities().DeviceJsonDocSize);
+	DeserializationError error = deserializeJson(fahJsonMsg, DetailsFilter->GetOutput());
+
+	if (error)
 	{
-		if (fahJsonMsg.containsKey(FreeAtHomeESPapi::KEY_ROOT))
+		DEBUG_P(F("deserializeJson() failed: ")); DEBUG_PL(error.f_str());
+		return;
+	}
+
+	LastDetailsHash = hash;
+	ProcessJsonDocument(fahJsonMsg);
+}
+
+String FahESPDevice::ProcessJsonDocument(JsonDocument& fahJsonMsg)
+{
+	if (fahJsonMsg.containsKey(FPSTR(FreeAtHomeESPapi::KEY_ROOT)))
+	{
+		JsonObject root = fahJsonMsg[FPSTR(FreeAtHomeESPapi::KEY_ROOT)].as<JsonObject>();
+		//Is device value response
+		if (root.containsKey(FPSTR(FreeAtHomeESPapi::KEY_VALUES)))
 		{
-			JsonObject root = fahJsonMsg[FreeAtHomeESPapi::KEY_ROOT].as<JsonObject>();
-			//Is device value response
-			if (root.containsKey(FreeAtHomeESPapi::KEY_VALUES))
+			JsonArray values = root[FPSTR(FreeAtHomeESPapi::KEY_VALUES)].as<JsonArray>();
+			if (values.size() == 1)
 			{
-				JsonArray values = root[FreeAtHomeESPapi::KEY_VALUES].as<JsonArray>();
-				if (values.size() == 1)
-				{
-					String s = values[0].as<String>();
-					//DEBUG_P(s.c_str());
-					return s;
-				}
+				String s = values[0].as<String>();
+				//DEBUG_P(s.c_str());
+				return s;
 			}
-			//Is device config response
-			else if (root.containsKey(FreeAtHomeESPapi::KEY_DEVICES))
+		}
+		//Is device config response
+		else if (root.containsKey(FPSTR(FreeAtHomeESPapi::KEY_DEVICES)))
+		{
+			JsonObject devices = root[FPSTR(FreeAtHomeESPapi::KEY_DEVICES)].as<JsonObject>();
+			String DevString = GetDeviceIDAsString();
+			if (devices.containsKey(DevString))
 			{
-				JsonObject devices = root[FreeAtHomeESPapi::KEY_DEVICES].as<JsonObject>();
-				String DevString = GetDeviceIDAsString();
-				if (devices.containsKey(DevString))
+				//Process Device and look for deviceName
+				JsonObject device = devices[DevString].as<JsonObject>();
+				if (device.containsKey(FPSTR(FreeAtHomeESPapi::KEY_DISPLAYNAME)))
 				{
-					//Process Device and look for deviceName
-					JsonObject device = devices[DevString].as<JsonObject>();
-					if (device.containsKey(FreeAtHomeESPapi::KEY_DISPLAYNAME))
+					JsonString value = device[FPSTR(FreeAtHomeESPapi::KEY_DISPLAYNAME)].as<JsonString>();
+					if (value.c_str() != NULL && DisplayName != value.c_str())
 					{
-						JsonString value = device[FreeAtHomeESPapi::KEY_DISPLAYNAME].as<JsonString>();
 						DisplayName = "" + String(value.c_str());
 						this->NotifyCallback(FAHESPAPI_EVENT::FAHESPAPI_ON_DISPLAYNAME, this->FahDevice, "", "", (void*)value.c_str());
 					}
+				}
 
-					//Process Channels and look for Parameters
-					if (device.containsKey(FreeAtHomeESPapi::KEY_CHANNELS))
+				//Process Channels and look for Parameters
+				if (device.containsKey(FPSTR(FreeAtHomeESPapi::KEY_CHANNELS)))
+				{
+					//DEBUG_PL("Channels");
+					JsonObject channels = device[FPSTR(FreeAtHomeESPapi::KEY_CHANNELS)].as<JsonObject>();
+					for (JsonPair keyChan : channels)
 					{
-						//DEBUG_PL("Channels");
-						JsonObject channels = device[FreeAtHomeESPapi::KEY_CHANNELS].as<JsonObject>();
-						for (JsonPair keyChan : channels)
-						{
-							String ChannelName = String(keyChan.key().c_str());
-							JsonObject Chan = keyChan.value().as<JsonObject>();
-							ProcessJsonDeviceParms(Chan, ChannelName);
-						}
+						JsonObject Chan = keyChan.value().as<JsonObject>();
+						ProcessJsonDeviceParms(Chan, keyChan.key().c_str());
 					}
-					
-					//Process Device and look for device parameters
-					ProcessJsonDeviceParms(device, "");
-				}				
-			}
+				}
+				
+				//Process Device and look for device parameters
+				ProcessJsonDeviceParms(device, "");
+			}				
 		}
 	}
 	return "";
 }
 
-void FahESPDevice::ProcessJsonDeviceParms(JsonObject &jsonObj, const String &channel)
+void FahESPDevice::ProcessJsonDeviceParms(JsonObject &jsonObj, const char* channel)
 {
-	if (jsonObj.containsKey(FreeAtHomeESPapi::KEY_PARAMETERS))
+	if (jsonObj.containsKey(FPSTR(FreeAtHomeESPapi::KEY_PARAMETERS)))
 	{
 		//DEBUG_PL("PARMS!");
-		JsonObject parms = jsonObj[FreeAtHomeESPapi::KEY_PARAMETERS].as<JsonObject>();
+		uint32_t channelHash = FahHashString(channel);
+		JsonObject parms = jsonObj[FPSTR(FreeAtHomeESPapi::KEY_PARAMETERS)].as<JsonObject>();
 		for (JsonPair keyParm : parms)
 		{
-			String Parm = String(keyParm.key().c_str());
-			if (Parm.indexOf(F("par")) == 0)
+			const char* Parm = keyParm.key().c_str();
+			if (strncmp_P(Parm, PSTR("par"), 3) == 0)
 			{
-				Parm = Parm.substring(3);
-				uint16_t iParm = strtol(Parm.c_str(), NULL, 16);
-				String Value = String(keyParm.value().as<JsonString>().c_str());
-				NotifyDeviceParameter(channel, iParm, Value);
-				/*Serial.print(channel);
-				Serial.print("->");
-				Serial.print();
-				Serial.print("==");
-				Serial.println(keyParm.value().as<JsonString>().c_str());*/
+				uint16_t iParm = strtol(Parm + 3, NULL, 16);
+				const char* Value = keyParm.value().as<JsonString>().c_str();
+				if (Value == NULL)
+					Value = "";
+
+				if (UpdateParameterCache(channelHash, iParm, FahHashString(Value)))
+				{
+					NotifyDeviceParameter(channel, iParm, Value);
+				}
 			}
 		}
 	}
 }
 
+bool FahESPDevice::UpdateParameterCache(const uint32_t& ChannelHash, const uint16_t& Parameter, const uint32_t& ValueHash)
+{
+	for (uint8_t i = 0; i < ParameterCacheCount; i++)
+	{
+		FahCachedParameter& cached = ParameterCache[i];
+		if (cached.ChannelHash == ChannelHash && cached.Parameter == Parameter)
+		{
+			if (cached.ValueHash == ValueHash)
+				return false;
+			cached.ValueHash = ValueHash;
+			return true;
+		}
+	}
+
+	//New parameter, when the cache is full it is always reported
+	if (ParameterCacheCount < MAX_CACHED_DEVICE_PARAMETERS)
+	{
+		ParameterCache[ParameterCacheCount].ChannelHash = ChannelHash;
+		ParameterCache[ParameterCacheCount].Parameter = Parameter;
+		ParameterCache[ParameterCacheCount].ValueHash = ValueHash;
+		ParameterCacheCount++;
+	}
+	return true;
+}
+
 String FahESPDevice::GetDeviceIDAsString()
 {
 	String sDeviceID = FreeAtHomeESPapi::U64toString(FahDevice);
@@ -233,22 +362,465 @@ bool FahESPDevice::GetDataPointAndChannelFromURL(const String& URL, String& chan
 	return false;
 }
 
-void FahESPDevice::processBase()
+void FahESPDevice::HoldOffSending()
 {
-	if (httpclt->GetAsyncStatus() == HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING)
+	SendHoldOff = true;
+	SendHoldOffStart = millis();
+}
+
+bool FahESPDevice::isSendAllowed()
+{
+	if (SendHoldOff)
+	{
+		if ((millis() - SendHoldOffStart) < FAH_REQUEST_FAILURE_HOLDOFF_MS)
+			return false;
+		SendHoldOff = false;
+	}
+	//SysAP unreachable, a request would fail without being sent and use up a retry
+	if (!httpclt->isSysApAvailable())
+		return false;
+	//Shared by all devices of the api, limits the request rate to the SysAP
+	return SysApApi->AcquireRequestToken();
+}
+
+unsigned long FahESPDevice::MillisUntilSendAllowed()
+{
+	unsigned long waitMs = 0;
+	if (SendHoldOff)
+	{
+		unsigned long elapsed = millis() - SendHoldOffStart;
+		if (elapsed < FAH_REQUEST_FAILURE_HOLDOFF_MS)
+			waitMs = FAH_REQUEST_FAILURE_HOLDOFF_MS - elapsed;
+	}
+	unsigned long breakerMs = httpclt->MillisUntilSysApAvailable();
+	if (breakerMs > waitMs)
+		waitMs = breakerMs;
+	unsigned long tokenMs = SysApApi->MillisUntilRequestToken();
+	return tokenMs > waitMs ? tokenMs : waitMs;
+}
+
+unsigned long FahESPDevice::NextDeadlineMs()
+{
+	//Timers (renewal, refresh, request timeout) are covered by the timer queue of the api
+	HTTPREQUEST_STATUS status = httpclt->GetAsyncStatus();
+	if (status == HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING)
+	{
+		//Waiting on the SysAP is signalled by the socket, sending the request is not
+		if (httpclt->GetState() < HTTPCLIENT_STATE::HTTPCLIENT_STATE_REQUESTED || RequestTimedOut || isInFlightPreemptable())
+			return 0;
+		return (unsigned long)-1;
+	}
+	else if (status != HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_NONE)
 	{
-		if ((millis() - httpclt->GetSessionStartMillis()) > HTTP_SESSION_TIMEOUT_MS)
+		//Completed request to be handled
+		return 0;
+	}
+
+	if (RenewalDue || ParameterRefreshDue)
+		return MillisUntilSendAllowed();
+
+	unsigned long deadline = (unsigned long)-1;
+	unsigned long now = millis();
+	for (uint8_t i = 0; i < PendingDataPointsCount; i++)
+	{
+		long untilEligible = (long)(PendingDataPoints[i].EligibleMillis - now);
+		if (untilEligible <= 0)
+			return MillisUntilSendAllowed();
+		if ((unsigned long)untilEligible < deadline)
+			deadline = untilEligible;
+	}
+	return deadline;
+}
+
+bool FahESPDevice::hasPendingWork()
+{
+	if (NextDeadlineMs() == 0)
+		return true;
+	//Response data of the request in flight
+	return httpclt->GetAsyncStatus() == HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING && httpclt->available() > 0;
+}
+
+void FahESPDevice::OnTimer(void* Context, const uint8_t& TimerID)
+{
+	//Only flag the work, it is picked up by the next processBase()
+	FahESPDevice* device = (FahESPDevice*)Context;
+	switch (TimerID)
+	{
+		case TIMER_RENEWAL:
+			device->RenewalTimer = 0;
+			device->RenewalDue = true;
+			device->RenewalDueSince = millis();
+			break;
+		case TIMER_PARAMETER_REFRESH:
+			device->ParameterRefreshTimer = 0;
+			device->ParameterRefreshDue = true;
+			device->ParameterRefreshDueSince = millis();
+			break;
+		case TIMER_REQUEST_TIMEOUT:
+			device->RequestTimeoutTimer = 0;
+			device->RequestTimedOut = true;
+			break;
+		default:
+			break;
+	}
+}
+
+void FahESPDevice::ScheduleRenewal()
+{
+	//Spread the renewals of devices created at the same moment
+	unsigned long jitter = random((WaitTimeMs * FAH_RENEWAL_JITTER_PERCENT) / 100 + 1);
+	SysApApi->GetTimerQueue().Cancel(RenewalTimer);
+	RenewalTimer = SysApApi->GetTimerQueue().Schedule(WaitTimeMs - jitter, OnTimer, this, TIMER_RENEWAL);
+}
+
+FAH_REQUEST_PRIORITY FahESPDevice::SelectNextRequest(int16_t& QueueIndex)
+{
+	//Highest class that is due wins, unless a lower class waited longer than the starvation bound
+	FAH_REQUEST_PRIORITY selected = FAH_REQUEST_PRIORITIES::FAH_PRIORITY_NONE;
+	int16_t selectedIndex = -1;
+	unsigned long now = millis();
+
+	for (uint8_t p = FAH_REQUEST_PRIORITIES::FAH_PRIORITY_INTERACTIVE; p <= FAH_REQUEST_PRIORITIES::FAH_PRIORITY_BACKGROUND; p++)
+	{
+		FAH_REQUEST_PRIORITY priority = (FAH_REQUEST_PRIORITY)p;
+		int16_t index = -1;
+		unsigned long dueSince = 0;
+
+		if (priority == FAH_REQUEST_PRIORITIES::FAH_PRIORITY_RENEWAL)
 		{
-			httpclt->ReleaseAsync();
-			lastSendGap = 200;
-			if (LastDequedDataPoint != "")
+			if (!RenewalDue)
+				continue;
+			dueSince = RenewalDueSince;
+		}
+		else if (priority == FAH_REQUEST_PRIORITIES::FAH_PRIORITY_BACKGROUND)
+		{
+			if (!ParameterRefreshDue)
+				continue;
+			dueSince = ParameterRefreshDueSince;
+		}
+		else
+		{
+			index = FindQueuedDataPoint(priority);
+			if (index < 0)
+				continue;
+			dueSince = PendingDataPoints[index].EnqueuedMillis;
+		}
+
+		if (selected == FAH_REQUEST_PRIORITIES::FAH_PRIORITY_NONE || (now - dueSince) > FAH_PRIORITY_STARVATION_MS)
+		{
+			selected = priority;
+			selectedIndex = index;
+			if ((now - dueSince) > FAH_PRIORITY_STARVATION_MS)
+				break;
+		}
+	}
+	QueueIndex = selectedIndex;
+	return selected;
+}
+
+bool FahESPDevice::isInFlightPreemptable()
+{
+	if (InFlightPriority < FAH_REQUEST_PRIORITIES::FAH_PRIORITY_RENEWAL || InFlightPriority == FAH_REQUEST_PRIORITIES::FAH_PRIORITY_NONE)
+		return false;
+
+	//Once the response is arriving it is cheaper to let it complete
+	if (httpclt->GetState() >= HTTPCLIENT_STATE::HTTPCLIENT_STATE_HEADERS)
+		return false;
+
+	if (PreemptCount >= FAH_MAX_PREEMPTIONS)
+		return false;
+
+	return FindQueuedDataPoint(FAH_REQUEST_PRIORITIES::FAH_PRIORITY_INTERACTIVE) >= 0;
+}
+
+void FahESPDevice::RescheduleInFlight()
+{
+	switch (InFlightPriority)
+	{
+		case FAH_REQUEST_PRIORITIES::FAH_PRIORITY_INTERACTIVE:
+		case FAH_REQUEST_PRIORITIES::FAH_PRIORITY_STATE:
+			//Back to the front of the queue, keeping the original age
+			EnqueDataPointEntry(InFlightDataPoint, true);
+			break;
+		case FAH_REQUEST_PRIORITIES::FAH_PRIORITY_RENEWAL:
+			RenewalDue = true;
+			break;
+		case FAH_REQUEST_PRIORITIES::FAH_PRIORITY_BACKGROUND:
+			ParameterRefreshDue = true;
+			break;
+		default:
+			break;
+	}
+	CompleteInFlight();
+}
+
+unsigned long FahESPDevice::GetRetryDelay(const uint8_t& Attempts)
+{
+	//Exponential backoff, jittered over the upper half so failing devices do not retry in step
+	unsigned long delayMs = FAH_RETRY_BACKOFF_MAX_MS;
+	if (Attempts > 0 && Attempts <= 16 && ((unsigned long)FAH_RETRY_BACKOFF_BASE_MS << (Attempts - 1)) < FAH_RETRY_BACKOFF_MAX_MS)
+		delayMs = (unsigned long)FAH_RETRY_BACKOFF_BASE_MS << (Attempts - 1);
+	return (delayMs / 2) + random((delayMs / 2) + 1);
+}
+
+void FahESPDevice::FailInFlight(const HTTPREQUEST_STATUS& Status, const uint16_t& HttpResult)
+{
+	Metrics.Failed++;
+	switch (InFlightPriority)
+	{
+		case FAH_REQUEST_PRIORITIES::FAH_PRIORITY_INTERACTIVE:
+		case FAH_REQUEST_PRIORITIES::FAH_PRIORITY_STATE:
+			InFlightDataPoint.Attempts++;
+			if (InFlightPriority == FAH_REQUEST_PRIORITIES::FAH_PRIORITY_INTERACTIVE && FindQueuedWrite(InFlightDataPoint.Entry) >= 0)
 			{
-				EnqueSetDataPoint(LastDequedDataPoint);
+				//A newer value for the datapoint is queued already, retrying the old one would overwrite it
+				Metrics.Superseded++;
+				NotifyDataPointCompleted(InFlightDataPoint, HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUPERSEDED, HttpResult, "");
+				break;
 			}
-			else
+			//Client errors will not succeed on a retry, except timeout and too many requests
+			if (InFlightDataPoint.Attempts < FAH_RETRY_MAX_ATTEMPTS && (HttpResult < 400 || HttpResult >= 500 || HttpResult == 408 || HttpResult == 429))
 			{
-				LastDequedDataPoint = "";
+				InFlightDataPoint.EligibleMillis = millis() + GetRetryDelay(InFlightDataPoint.Attempts);
+				if (EnqueDataPointEntry(InFlightDataPoint, true))
+				{
+					Metrics.Retried++;
+					break;
+				}
 			}
+			DeadLetterInFlight(Status, HttpResult);
+			break;
+		case FAH_REQUEST_PRIORITIES::FAH_PRIORITY_RENEWAL:
+		{
+			//Keeps retrying, but never later than the regular renewal
+			unsigned long retryDelay = GetRetryDelay(++RenewalAttempts);
+			if (retryDelay > WaitTimeMs)
+				retryDelay = WaitTimeMs;
+			RenewalDue = false;
+			SysApApi->GetTimerQueue().Cancel(RenewalTimer);
+			RenewalTimer = SysApApi->GetTimerQueue().Schedule(retryDelay, OnTimer, this, TIMER_RENEWAL);
+			Metrics.Retried++;
+			break;
+		}
+		case FAH_REQUEST_PRIORITIES::FAH_PRIORITY_BACKGROUND:
+			//Next attempt after one renewal interval
+			ParameterRefreshDue = false;
+			SysApApi->GetTimerQueue().Cancel(ParameterRefreshTimer);
+			ParameterRefreshTimer = SysApApi->GetTimerQueue().Schedule(WaitTimeMs, OnTimer, this, TIMER_PARAMETER_REFRESH);
+			Metrics.Retried++;
+			break;
+		default:
+			break;
+	}
+	CompleteInFlight();
+}
+
+void FahESPDevice::DeadLetterInFlight(const HTTPREQUEST_STATUS& Status, const uint16_t& HttpResult)
+{
+	String strRequestType = "";
+	String channel = "";
+	String datapoint = "";
+	String strValue = "";
+	SplitDataPointEntry(InFlightDataPoint.Entry, strRequestType, channel, datapoint, strValue);
+
+	DEBUG_P(F("DeadLetter: ")); DEBUG_PL(InFlightDataPoint.Entry);
+	Metrics.DeadLettered++;
+	NotifyDataPointCompleted(InFlightDataPoint, Status, HttpResult, "");
+	this->NotifyCallback(FAHESPAPI_EVENT::FAHESPAPI_ON_REQUEST_DEADLETTER, this->FahDevice, channel.c_str(), datapoint.c_str(), (void*)strValue.c_str());
+}
+
+void FahESPDevice::SplitDataPointEntry(const String& Entry, String& RequestType, String& Channel, String& DataPoint, String& Value)
+{
+	//Entry format is "PUT:device.channel.datapoint:value"
+	String strDataPointPart = "";
+	FreeAtHomeESPapi::GetStringToken(Entry, RequestType, 0, ':');
+	FreeAtHomeESPapi::GetStringToken(Entry, strDataPointPart, 1, ':');
+	FreeAtHomeESPapi::GetStringToken(Entry, Value, 2, ':');
+	FreeAtHomeESPapi::GetStringToken(strDataPointPart, Channel, 1, '.');
+	FreeAtHomeESPapi::GetStringToken(strDataPointPart, DataPoint, 2, '.');
+}
+
+void FahESPDevice::NotifyDataPointCompleted(const FahQueuedDataPoint& DataPoint, const HTTPREQUEST_STATUS& Status, const uint16_t& HttpResult, const String& ReadValue)
+{
+	if (DataPoint.Callback == NULL && !TrackDataPointCompletion)
+		return;
+
+	String strRequestType = "";
+	String channel = "";
+	String datapoint = "";
+	String strValue = "";
+	SplitDataPointEntry(DataPoint.Entry, strRequestType, channel, datapoint, strValue);
+
+	FahDataPointResult result;
+	result.Status = Status;
+	result.HttpResult = HttpResult;
+	result.LatencyMs = millis() - DataPoint.EnqueuedMillis;
+	result.Attempts = DataPoint.Attempts;
+	result.isGetValue = (DataPoint.Priority == FAH_REQUEST_PRIORITIES::FAH_PRIORITY_STATE);
+	if (result.isGetValue)
+		strValue = ReadValue;
+	result.Channel = channel.c_str();
+	result.DataPoint = datapoint.c_str();
+	result.Value = strValue.c_str();
+
+	if (TrackDataPointCompletion)
+		NotifyDataPointResult(result);
+	if (DataPoint.Callback != NULL)
+		DataPoint.Callback(this, result, DataPoint.Context);
+}
+
+void FahESPDevice::NotifyDataPointResult(const FahDataPointResult& Result)
+{
+}
+
+void FahESPDevice::CompleteInFlight()
+{
+	SysApApi->GetTimerQueue().Cancel(RequestTimeoutTimer);
+	RequestTimedOut = false;
+	InFlightPriority = FAH_REQUEST_PRIORITIES::FAH_PRIORITY_NONE;
+	InFlightDataPoint.Entry = "";
+	if (DetailsFilter != NULL)
+	{
+		httpclt->SetBodySink(NULL);
+		delete DetailsFilter;
+		DetailsFilter = NULL;
+	}
+}
+
+bool FahESPDevice::StartDataPointRequest(const int16_t& QueueIndex)
+{
+	DequeDataPoint(QueueIndex, InFlightDataPoint);
+	InFlightPriority = InFlightDataPoint.Priority;
+
+	String strDataPointRequestType = "";
+	String strDataPointPart = "";
+	String strDataPointValue = "";
+
+	uint8_t token_idx = 0;
+	if (FreeAtHomeESPapi::GetStringToken(InFlightDataPoint.Entry, strDataPointRequestType, token_idx, ':'))
+	{
+		token_idx++;
+		if (FreeAtHomeESPapi::GetStringToken(InFlightDataPoint.Entry, strDataPointPart, token_idx, ':'))
+		{
+			token_idx++;
+			if (strDataPointRequestType == String(F("GET")) || FreeAtHomeESPapi::GetStringToken(InFlightDataPoint.Entry, strDataPointValue, token_idx, ':'))
+			{
+				String URI = FreeAtHomeESPapi::ConstructDeviceDataPointNotificationURI(strDataPointPart);
+				//DEBUG_PL(URI); DEBUG_PL(strDataPointRequestType); DEBUG_PL(strDataPointPart);
+
+				if (httpclt->HTTPRequestAsync(strDataPointRequestType, URI, strDataPointValue))
+					return true;
+
+				//Failed to send, retry after a backoff
+				FailInFlight(HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED, 0);
+				//DEBUG_P("ERROR_DPN:"); DEBUG_P(strDataPointPart); DEBUG_P(", Value:"); DEBUG_PL(strDataPointValue);
+				return false;
+			}
+		}
+	}
+	//Malformed entry, drop it
+	NotifyDataPointCompleted(InFlightDataPoint, HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED, 0, "");
+	CompleteInFlight();
+	return true;
+}
+
+bool FahESPDevice::StartRenewal()
+{
+	//DEBUG_P(F("Update: ")); DEBUG_PL((millis() - this->LastWaitInterval));
+	String URI = FreeAtHomeESPapi::ConstructDeviceRegistrationURI(SerialNr);
+	String HTTPPostData = FreeAtHomeESPapi::ConstructDeviceRegistrationBody(this->FahDeviceType, "", this->TimeOut);
+	if (!httpclt->HTTPRequestAsync(String(F("PUT")), URI, HTTPPostData))
+	{
+		InFlightPriority = FAH_REQUEST_PRIORITIES::FAH_PRIORITY_RENEWAL;
+		FailInFlight(HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED, 0);
+		return false;
+	}
+
+	//ASync started, schedule the next one
+	InFlightPriority = FAH_REQUEST_PRIORITIES::FAH_PRIORITY_RENEWAL;
+	RenewalDue = false;
+	this->LastWaitInterval = millis();
+	ScheduleRenewal();
+	return true;
+}
+
+bool FahESPDevice::StartParameterRefresh()
+{
+	String URI = FreeAtHomeESPapi::ConstructGetDeviceDetailsURI(GetDeviceIDAsString());
+	//DEBUG_PL(URI);
+
+	//The body is filtered as it arrives, only the members that are processed are kept
+	String device = String(FPSTR(FreeAtHomeESPapi::KEY_ROOT)) + '/' + FPSTR(FreeAtHomeESPapi::KEY_DEVICES) + '/' + GetDeviceIDAsString() + '/';
+	DetailsFilter = new FahJsonFilter(SysApApi->GetCapacities().DeviceJsonDocSize);
+	DetailsFilter->AddPath(device + FPSTR(FreeAtHomeESPapi::KEY_DISPLAYNAME));
+	DetailsFilter->AddPath(device + FPSTR(FreeAtHomeESPapi::KEY_PARAMETERS));
+	DetailsFilter->AddPath(device + FPSTR(FreeAtHomeESPapi::KEY_CHANNELS) + F("/*/") + FPSTR(FreeAtHomeESPapi::KEY_PARAMETERS));
+
+	InFlightPriority = FAH_REQUEST_PRIORITIES::FAH_PRIORITY_BACKGROUND;
+	if (!httpclt->HTTPRequestAsync("GET", URI, "", DetailsFilter))
+	{
+		FailInFlight(HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED, 0);
+		return false;
+	}
+	ParameterRefreshDue = false;
+	SysApApi->GetTimerQueue().Cancel(ParameterRefreshTimer);
+	ParameterRefreshTimer = SysApApi->GetTimerQueue().Schedule(WaitTimeMs * PARAMETER_REFRESH_INTERVAL, OnTimer, this, TIMER_PARAMETER_REFRESH);
+	return true;
+}
+
+void FahESPDevice::StartNextRequest()
+{
+	int16_t queueIndex = -1;
+	FAH_REQUEST_PRIORITY next = SelectNextRequest(queueIndex);
+	if (next == FAH_REQUEST_PRIORITIES::FAH_PRIORITY_NONE || !isSendAllowed())
+		return;
+
+	bool started = false;
+	switch (next)
+	{
+		case FAH_REQUEST_PRIORITIES::FAH_PRIORITY_INTERACTIVE:
+		case FAH_REQUEST_PRIORITIES::FAH_PRIORITY_STATE:
+			started = StartDataPointRequest(queueIndex);
+			break;
+		case FAH_REQUEST_PRIORITIES::FAH_PRIORITY_RENEWAL:
+			started = StartRenewal();
+			break;
+		case FAH_REQUEST_PRIORITIES::FAH_PRIORITY_BACKGROUND:
+			started = StartParameterRefresh();
+			break;
+		default:
+			break;
+	}
+
+	if (!started)
+		HoldOffSending();
+	else
+		Metrics.Sent++;
+
+	if (started && InFlightPriority != FAH_REQUEST_PRIORITIES::FAH_PRIORITY_NONE)
+		RequestTimeoutTimer = SysApApi->GetTimerQueue().Schedule(HTTP_SESSION_TIMEOUT_MS, OnTimer, this, TIMER_REQUEST_TIMEOUT);
+}
+
+void FahESPDevice::processBase()
+{
+	if (httpclt->GetAsyncStatus() == HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING)
+	{
+		if (RequestTimedOut)
+		{
+			httpclt->ReleaseAsync();
+			HoldOffSending();
+			Metrics.TimedOut++;
+			FailInFlight(HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_TIMEOUT, 0);
+		}
+		else if (isInFlightPreemptable())
+		{
+			//Interactive write waiting, retry the lower class request afterwards
+			DEBUG_PL(F("Preempt"));
+			httpclt->ReleaseAsync();
+			PreemptCount++;
+			Metrics.Preempted++;
+			RescheduleInFlight();
+			StartNextRequest();
 		}
 		else
 		{
@@ -258,15 +830,17 @@ void FahESPDevice::processBase()
 	}
 	else if (httpclt->GetAsyncStatus() == HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED)
 	{
-		//DEBUG_PL(httpclt->)
+		uint16_t httpResult = httpclt->GetLastResultCode();
 		httpclt->ReleaseAsync();
-		lastSendGap = 200;
+		HoldOffSending();
+		FailInFlight(HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED, httpResult);
 	}
 	else if (httpclt->GetAsyncStatus() == HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS)
 	{
+		String value = "";
 		if (httpclt->LastRequestMethod() == String(F("GET")))
 		{
-			if (httpclt->GetResponseHeaderByKey(String(F("content-type"))) == String(F("application/json")))
+			if (strncmp_P(httpclt->GetResponseHeader(HTTPCLIENT_HEADER::HTTPCLIENT_HEADER_CONTENT_TYPE), PSTR("application/json"), 16) == 0)
 			{
 				if (httpclt->LastURIRequested().indexOf(F("/rest/datapoint/")) > 0)
 				{
@@ -277,7 +851,7 @@ void FahESPDevice::processBase()
 					String DataPoint = "";
 					if (GetDataPointAndChannelFromURL(httpclt->LastURIRequested(), Channel, DataPoint))
 					{
-						String value = ProcessJsonFromResponse(returndata);
+						value = ProcessJsonFromResponse(returndata);
 						if (value.length() > 0)
 						{
 							//DEBUG_F("CH: %s, DP: %s, Val: %s\r\n", Channel.c_str(), DataPoint.c_str(), value.c_str());
@@ -285,96 +859,26 @@ void FahESPDevice::processBase()
 						}
 					}
 				}
-				else if (httpclt->LastURIRequested().indexOf(F("/rest/device/")) > 0)
+				else if (InFlightPriority == FAH_REQUEST_PRIORITIES::FAH_PRIORITY_BACKGROUND)
 				{
-					String returndata = httpclt->GetBody();
-					//DEBUG_P(String(F("ProcRD: "))); DEBUG_PL(returndata);
-					String d = ProcessJsonFromResponse(returndata);
+					//Device details, filtered while the body was received
+					ProcessDetails();
 				}
 			}
 		}
+		if (InFlightPriority <= FAH_REQUEST_PRIORITIES::FAH_PRIORITY_STATE)
+			NotifyDataPointCompleted(InFlightDataPoint, HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS, httpclt->GetLastResultCode(), value);
 		httpclt->ReleaseAsync();
-		lastSendGap = 50;
+		if (InFlightPriority >= FAH_REQUEST_PRIORITIES::FAH_PRIORITY_RENEWAL)
+			PreemptCount = 0;
+		if (InFlightPriority == FAH_REQUEST_PRIORITIES::FAH_PRIORITY_RENEWAL)
+			RenewalAttempts = 0;
+		Metrics.Succeeded++;
+		CompleteInFlight();
 	}
-
-	//Update Registration
-	else if ((millis() - this->LastWaitInterval) > this->WaitTimeMs)
-	{
-		if (lastSendGap == 0)
-		{
-			//DEBUG_P(F("Update: ")); DEBUG_PL((millis() - this->LastWaitInterval));
-
-			String URI = FreeAtHomeESPapi::ConstructDeviceRegistrationURI(SerialNr);
-			String HTTPPostData = FreeAtHomeESPapi::ConstructDeviceRegistrationBody(this->FahDeviceType, "", this->TimeOut);
-			if (httpclt->HTTPRequestAsync(String(F("PUT")), URI, HTTPPostData))
-			{
-				//ASync started, reset counter
-				this->LastWaitInterval = millis();
-				if (this->requestConfigSkip > 0)
-				{
-					this->requestConfigSkip--;
-				}
-			}
-		}
-	}
-
-	//Send datapoints
-	else if (PendingDataPointsCount > 0)
-	{
-		if (lastSendGap == 0)
-		{
-			LastDequedDataPoint = DequeDataPoint();
-			String strDataPointRequestType = "";
-			String strDataPointPart = "";
-			String strDataPointValue = "";
-
-			uint8_t token_idx = 0;
-			if (FreeAtHomeESPapi::GetStringToken(LastDequedDataPoint, strDataPointRequestType, token_idx, ':'))
-			{
-				token_idx++;
-				if (FreeAtHomeESPapi::GetStringToken(LastDequedDataPoint, strDataPointPart, token_idx, ':'))
-				{
-					token_idx++;
-					if (strDataPointRequestType == String(F("GET")) || FreeAtHomeESPapi::GetStringToken(LastDequedDataPoint, strDataPointValue, token_idx, ':'))
-					{
-						String URI = FreeAtHomeESPapi::ConstructDeviceDataPointNotificationURI(strDataPointPart);
-						//DEBUG_PL(URI); DEBUG_PL(strDataPointRequestType); DEBUG_PL(strDataPointPart);
-
-						if (!httpclt->HTTPRequestAsync(strDataPointRequestType, URI, strDataPointValue))
-						{
-							if (PendingDataPointsCount != MAX_PENDING_DATAPOINTS)
-							{
-								//Put it back, failed to send
-								//But only if the que is not filled completly
-								EnqueSetDataPoint(LastDequedDataPoint);
-							}
-							lastSendGap = 200;
-							//DEBUG_P("ERROR_DPN:"); DEBUG_P(strDataPointPart); DEBUG_P(", Value:"); DEBUG_PL(strDataPointValue);
-						}
-					}
-				}
-			}
-		}
-	}
-
-	//Get Parameters
-	else if (this->requestConfigSkip == 0 && lastSendGap == 0)
-	{
-		String URI = FreeAtHomeESPapi::ConstructGetDeviceDetailsURI(GetDeviceIDAsString());
-		//DEBUG_PL(URI);
-
-		if (!httpclt->HTTPRequestAsync("GET", URI, ""))
-		{
-			requestConfigSkip = 1;
-		}
-		else
-		{
-			requestConfigSkip = PARAMETER_REFRESH_INTERVAL;
-		}		
-	}
-	if (lastSendGap > 0)
+	else
 	{
-		lastSendGap--;
+		StartNextRequest();
 	}
 }
 
@@ -16,12 +16,75 @@
 #include "FreeAtHomeESPapi.h"
 #include "FahSysAPInfo.h"
 #include "FahHTTPClient.h"
+#include "FahJsonFilter.h"
+#include "FahTimerQueue.h"
 
 class FreeAtHomeESPapi;
 class FahSysAPInfo;
 
-#define MAX_PENDING_DATAPOINTS 10
 #define PARAMETER_REFRESH_INTERVAL 10
+#define MAX_CACHED_DEVICE_PARAMETERS 24
+
+namespace FAH_REQUEST_PRIORITIES
+{
+	//Lower value is sent first
+	enum FAH_REQUEST_PRIORITY :uint8_t
+	{
+		FAH_PRIORITY_INTERACTIVE = 0, //Datapoint writes
+		FAH_PRIORITY_STATE = 1, //Datapoint reads
+		FAH_PRIORITY_RENEWAL = 2, //Device registration renewal
+		FAH_PRIORITY_BACKGROUND = 3, //Device parameter refresh
+		FAH_PRIORITY_NONE = 0xFF,
+	};
+}
+typedef FAH_REQUEST_PRIORITIES::FAH_REQUEST_PRIORITY FAH_REQUEST_PRIORITY;
+
+class FahESPDevice;
+
+//Outcome of a queued datapoint request, the strings are only valid during the callback
+struct FahDataPointResult
+{
+	HTTPREQUEST_STATUS Status = HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_NONE; //SUCCESS, FAILED, TIMEOUT or SUPERSEDED
+	uint16_t HttpResult = 0; //0 when no response was received
+	unsigned long LatencyMs = 0; //From enqueue to completion, retries included
+	uint8_t Attempts = 0; //Failed attempts before completion
+	bool isGetValue = false;
+	const char* Channel = "";
+	const char* DataPoint = "";
+	const char* Value = ""; //Value written, or the value read for a get
+};
+
+typedef void (*FAHESP_DATAPOINT_CALLBACK)(FahESPDevice* Device, const FahDataPointResult& Result, void* Context);
+
+struct FahCachedParameter
+{
+	uint32_t ChannelHash = 0;
+	uint16_t Parameter = 0;
+	uint32_t ValueHash = 0;
+};
+
+struct FahQueuedDataPoint
+{
+	String Entry = "";
+	FAH_REQUEST_PRIORITY Priority = FAH_REQUEST_PRIORITIES::FAH_PRIORITY_NONE;
+	unsigned long EnqueuedMillis = 0;
+	unsigned long EligibleMillis = 0; //Not sent before this time while backing off
+	uint8_t Attempts = 0;
+	FAHESP_DATAPOINT_CALLBACK Callback = NULL;
+	void* Context = NULL;
+};
+
+struct FahRequestMetrics
+{
+	uint32_t Sent = 0;
+	uint32_t Succeeded = 0;
+	uint32_t Failed = 0;
+	uint32_t TimedOut = 0;
+	uint32_t Retried = 0;
+	uint32_t DeadLettered = 0;
+	uint32_t Superseded = 0;
+	uint32_t Preempted = 0;
+};
 
 class FahESPDevice : public FahEventEnabledClass
 {
@@ -31,36 +94,89 @@ class FahESPDevice : public FahEventEnabledClass
 		String FahDeviceType;
 		String SerialNr;
 		uint64_t FahDevice = 0;
-		bool EnqueDataPoint(const bool &GetValue, const String Channel, const String DataPoint, const String Value);
-		bool EnqueSetDataPoint(const String Channel, const String DataPoint, const String Value);
-		bool EnqueGetDataPoint(const String Channel, const String DataPoint);
-		bool EnqueSetDataPoint(const String Entry);
+		bool EnqueDataPoint(const bool &GetValue, const String Channel, const String DataPoint, const String Value, FAHESP_DATAPOINT_CALLBACK Callback = NULL, void* Context = NULL);
+		bool EnqueSetDataPoint(const String Entry, FAHESP_DATAPOINT_CALLBACK Callback = NULL, void* Context = NULL);
 		String ProcessJsonFromResponse(const String& Response);		
+		void ProcessDetails();
+		String ProcessJsonDocument(JsonDocument& fahJsonMsg);
 		bool GetDataPointAndChannelFromURL(const String& URL, String& channel, String& datapoint);
 		String GetDeviceIDAsString();
 		virtual void NotifyDeviceParameter(const String& strChannel, const uint16_t& Parameter, const String& strValue);
-		String LastDequedDataPoint = "";
+		virtual void NotifyDataPointResult(const FahDataPointResult& Result);
+		bool TrackDataPointCompletion = false; //NotifyDataPointResult is called for every completed datapoint request
 	private:
-		void ProcessJsonDeviceParms(JsonObject& jsonObj, const String& channel);
+		enum DeviceTimer :uint8_t
+		{
+			TIMER_RENEWAL = 1,
+			TIMER_PARAMETER_REFRESH,
+			TIMER_REQUEST_TIMEOUT,
+		};
+		void ProcessJsonDeviceParms(JsonObject& jsonObj, const char* channel);
+		FahCachedParameter ParameterCache[MAX_CACHED_DEVICE_PARAMETERS];
+		uint8_t ParameterCacheCount = 0;
+		uint32_t LastDetailsHash = 0;
+		FahJsonFilter* DetailsFilter = NULL; //Only while a details request is in flight
+		bool UpdateParameterCache(const uint32_t& ChannelHash, const uint16_t& Parameter, const uint32_t& ValueHash);
 		String DisplayName = "";
-		String* PendingDataPoints = NULL;
+		FahQueuedDataPoint* PendingDataPoints = NULL; //MaxPendingDataPoints entries, sized by the capacities of the api
+		uint8_t MaxPendingDataPoints = 0;
 		uint8_t PendingDataPointsCount = 0;
+		bool EnqueDataPointEntry(const FahQueuedDataPoint& DataPoint, const bool& AtFront);
+		void DequeDataPoint(const uint8_t& Index, FahQueuedDataPoint& DataPoint);
+		int16_t FindQueuedDataPoint(const FAH_REQUEST_PRIORITY& Priority);
+		int16_t FindQueuedWrite(const String& Entry);
+		FahQueuedDataPoint InFlightDataPoint;
+		FAH_REQUEST_PRIORITY InFlightPriority = FAH_REQUEST_PRIORITIES::FAH_PRIORITY_NONE;
+		uint8_t PreemptCount = 0;
+		bool RenewalDue = false;
+		unsigned long RenewalDueSince = 0;
+		unsigned long ParameterRefreshDueSince = 0;
+		FAH_REQUEST_PRIORITY SelectNextRequest(int16_t& QueueIndex);
+		bool isInFlightPreemptable();
+		void RescheduleInFlight();
+		void CompleteInFlight();
+		void FailInFlight(const HTTPREQUEST_STATUS& Status, const uint16_t& HttpResult);
+		void DeadLetterInFlight(const HTTPREQUEST_STATUS& Status, const uint16_t& HttpResult);
+		void NotifyDataPointCompleted(const FahQueuedDataPoint& DataPoint, const HTTPREQUEST_STATUS& Status, const uint16_t& HttpResult, const String& ReadValue);
+		static void SplitDataPointEntry(const String& Entry, String& RequestType, String& Channel, String& DataPoint, String& Value);
+		static unsigned long GetRetryDelay(const uint8_t& Attempts);
+		uint8_t RenewalAttempts = 0;
+		FahRequestMetrics Metrics;
+		void StartNextRequest();
+		bool StartDataPointRequest(const int16_t& QueueIndex);
+		bool StartRenewal();
+		bool StartParameterRefresh();
+		static void OnTimer(void* Context, const uint8_t& TimerID);
+		void ScheduleRenewal();
+		FAH_TIMER_HANDLE RenewalTimer = 0;
+		FAH_TIMER_HANDLE ParameterRefreshTimer = 0;
+		FAH_TIMER_HANDLE RequestTimeoutTimer = 0;
+		bool RequestTimedOut = false;
+		bool ParameterRefreshDue = true;
 		uint16_t TimeOut = 300;
 		unsigned long WaitTimeMs = 0;
 		FreeAtHomeESPapi* refParent = NULL;
 		unsigned long LastWaitInterval = 0;
-		String DequeDataPoint();
-		uint8_t lastSendGap = 0;		
-		int requestConfigSkip = 0;
+		unsigned long SendHoldOffStart = 0;
+		bool SendHoldOff = false;
+		void HoldOffSending();
+		bool isSendAllowed();
+		unsigned long MillisUntilSendAllowed();
 	public:
 		String GetDisplayName() { return DisplayName; };
 		uint8_t GetPendingDatapointCount() { return PendingDataPointsCount; };
+		uint8_t GetFreeDatapointSlots() { return MaxPendingDataPoints - PendingDataPointsCount; };
 		unsigned long GetMScounter() { return LastWaitInterval; };
+		const FahRequestMetrics& GetRequestMetrics() { return Metrics; };
+		unsigned long NextDeadlineMs();
+		bool hasPendingWork();
+		bool EnqueSetDataPoint(const String Channel, const String DataPoint, const String Value, FAHESP_DATAPOINT_CALLBACK Callback = NULL, void* Context = NULL);
+		bool EnqueGetDataPoint(const String Channel, const String DataPoint, FAHESP_DATAPOINT_CALLBACK Callback = NULL, void* Context = NULL);
 		virtual void NotifyFahDataPoint(const String& strChannel, const String& strDataPoint, const String& strValue, const bool& isSceneOrGetValue);
 		virtual void NotifyOnSysAPReconnect();
 		uint64_t GetFahDeviceID();
 		FahESPDevice(const String& FahDeviceType, const uint64_t& FahAbbID, const String& SerialNr, const uint16_t& timeout, FreeAtHomeESPapi* fahParent, FahSysAPInfo* SysApInfo);
-		~FahESPDevice();		
+		virtual ~FahESPDevice();		
 		virtual void process();
 		void processBase();
 };
@@ -0,0 +1,241 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahESPGenericDevice.h"
+
+using namespace FAH_DATAPOINT_DIRECTIONS;
+
+FahESPGenericDevice::FahESPGenericDevice(const FahDeviceSchema& Schema, const uint64_t& FahAbbID, const String& SerialNr, const uint16_t& timeout, FreeAtHomeESPapi* fahParent, FahSysAPInfo* SysApInfo):FahESPDevice(String(Schema.DeviceType), FahAbbID, SerialNr, timeout, fahParent, SysApInfo), Schema(Schema)
+{
+	if (Schema.DataPointCount > 0)
+	{
+		Values = new float[Schema.DataPointCount];
+		for (uint8_t i = 0; i < Schema.DataPointCount; i++)
+			Values[i] = 0;
+	}
+
+	//Schemas of the library are sorted, a table that is not is still usable with a linear search
+	DataPointsSorted = true;
+	for (uint8_t i = 1; i < Schema.DataPointCount; i++)
+	{
+		if (Schema.DataPoints[i - 1].Key() >= Schema.DataPoints[i].Key())
+			DataPointsSorted = false;
+	}
+	if (Schema.ParameterCount > 0)
+	{
+		ParameterValues = new int32_t[Schema.ParameterCount];
+		for (uint8_t i = 0; i < Schema.ParameterCount; i++)
+			ParameterValues[i] = 0;
+	}
+
+	//Functionality identical when reconnect of SysAP
+	NotifyOnSysAPReconnect();
+}
+
+void FahESPGenericDevice::process()
+{
+	processBase();
+}
+
+FahESPGenericDevice::~FahESPGenericDevice()
+{
+	if (Values != NULL)
+		delete[] Values;
+	if (ParameterValues != NULL)
+		delete[] ParameterValues;
+}
+
+void FahESPGenericDevice::NotifyOnSysAPReconnect()
+{
+	for (uint8_t i = 0; i < Schema.DataPointCount; i++)
+	{
+		const FahDataPointSchema& dp = Schema.DataPoints[i];
+		if (dp.Direction == FAH_DP_OUTPUT && dp.ReadOnReconnect)
+		{
+			EnqueGetDataPoint(FreeAtHomeESPapi::GetChannelString(dp.Channel), FreeAtHomeESPapi::GetODPString(dp.DataPoint));
+		}
+	}
+}
+
+bool FahESPGenericDevice::ParseHexSuffix(const String& Value, const uint8_t& PrefixLength, uint8_t& Number)
+{
+	if (Value.length() <= PrefixLength)
+		return false;
+
+	uint16_t result = 0;
+	for (uint16_t i = PrefixLength; i < Value.length(); i++)
+	{
+		char c = Value[i];
+		if (c >= '0' && c <= '9')
+			result = (result << 4) | (c - '0');
+		else if (c >= 'A' && c <= 'F')
+			result = (result << 4) | (c - 'A' + 10);
+		else if (c >= 'a' && c <= 'f')
+			result = (result << 4) | (c - 'a' + 10);
+		else
+			return false;
+		if (result > 0xFF)
+			return false;
+	}
+	Number = result;
+	return true;
+}
+
+bool FahESPGenericDevice::ParseDataPointKey(const String& strChannel, const String& strDataPoint, FAH_DATAPOINT_KEY& Key)
+{
+	//ch0000 and idp0000 / odp0000, numbers are hexadecimal
+	uint8_t channel, datapoint;
+	if (!strChannel.startsWith("ch") || !ParseHexSuffix(strChannel, 2, channel))
+		return false;
+	if (!ParseHexSuffix(strDataPoint, 3, datapoint))
+		return false;
+
+	if (strDataPoint.startsWith("idp"))
+		Key = FahDataPointKey(channel, FAH_DP_INPUT, datapoint);
+	else if (strDataPoint.startsWith("odp"))
+		Key = FahDataPointKey(channel, FAH_DP_OUTPUT, datapoint);
+	else
+		return false;
+	return true;
+}
+
+int16_t FahESPGenericDevice::FindDataPoint(const FAH_DATAPOINT_KEY& Key)
+{
+	if (DataPointsSorted)
+	{
+		int16_t low = 0;
+		int16_t high = (int16_t)Schema.DataPointCount - 1;
+		while (low <= high)
+		{
+			int16_t mid = (low + high) / 2;
+			FAH_DATAPOINT_KEY midKey = Schema.DataPoints[mid].Key();
+			if (midKey == Key)
+				return mid;
+			if (midKey < Key)
+				low = mid + 1;
+			else
+				high = mid - 1;
+		}
+		return FAH_SCHEMA_NOT_FOUND;
+	}
+
+	for (uint8_t i = 0; i < Schema.DataPointCount; i++)
+	{
+		if (Schema.DataPoints[i].Key() == Key)
+			return i;
+	}
+	return FAH_SCHEMA_NOT_FOUND;
+}
+
+int16_t FahESPGenericDevice::FindParameter(const uint8_t& Channel, const uint16_t& Parameter)
+{
+	for (uint8_t i = 0; i < Schema.ParameterCount; i++)
+	{
+		if (Schema.Parameters[i].Channel == Channel && Schema.Parameters[i].Parameter == Parameter)
+			return i;
+	}
+	return FAH_SCHEMA_NOT_FOUND;
+}
+
+float FahESPGenericDevice::GetValue(const uint8_t& Index)
+{
+	if (Index >= Schema.DataPointCount)
+		return 0;
+	return Values[Index];
+}
+
+int32_t FahESPGenericDevice::GetParameterValue(const uint8_t& Index)
+{
+	if (Index >= Schema.ParameterCount)
+		return 0;
+	return ParameterValues[Index];
+}
+
+String FahESPGenericDevice::FormatValue(const FahDataPointSchema& DataPoint, const float& Value)
+{
+	switch (DataPoint.ValueType)
+	{
+		case FAH_VALUE_TYPES::FAH_VALUE_BOOL:
+			return String(FPSTR(Value != 0 ? FreeAtHomeESPapi::VALUE_1 : FreeAtHomeESPapi::VALUE_0));
+		case FAH_VALUE_TYPES::FAH_VALUE_UINT:
+			return String((unsigned long)(Value < 0 ? 0 : Value + 0.5f));
+		default:
+			return String(Value, 2);
+	}
+}
+
+void FahESPGenericDevice::UpdateValue(const uint8_t& Index, const float& Value)
+{
+	Values[Index] = Value;
+	if (ValueCallback != NULL)
+	{
+		ValueCallback(this, Schema.DataPoints[Index], Value, ValueCallbackContext);
+	}
+}
+
+bool FahESPGenericDevice::SetValue(const uint8_t& Index, const float& Value, FAHESP_DATAPOINT_CALLBACK Callback, void* Context)
+{
+	if (Index >= Schema.DataPointCount || Schema.DataPoints[Index].Direction != FAH_DP_OUTPUT)
+		return false;
+
+	const FahDataPointSchema& dp = Schema.DataPoints[Index];
+	Values[Index] = Value;
+	return EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(dp.Channel), FreeAtHomeESPapi::GetODPString(dp.DataPoint), FormatValue(dp, Value), Callback, Context);
+}
+
+void FahESPGenericDevice::NotifyFahDataPoint(const String& strChannel, const String& strDataPoint, const String& strValue, const bool& isSceneOrGetValue)
+{
+	FAH_DATAPOINT_KEY key;
+	if (!ParseDataPointKey(strChannel, strDataPoint, key))
+		return;
+
+	int16_t index = FindDataPoint(key);
+	if (index == FAH_SCHEMA_NOT_FOUND)
+		return;
+
+	const FahDataPointSchema& dp = Schema.DataPoints[index];
+	float value = strValue.toFloat();
+	if (dp.Direction == FAH_DP_OUTPUT)
+	{
+		//Read back of the own output, only the local copy is updated
+		if (isSceneOrGetValue)
+			UpdateValue(index, value);
+		return;
+	}
+
+	UpdateValue(index, value);
+	if (dp.Feedback != FAH_DP_NO_FEEDBACK && SetValue(dp.Feedback, value))
+	{
+		//Reported as the output datapoint that carries the value, not as the input that was written
+		const FahDataPointSchema& feedback = Schema.DataPoints[dp.Feedback];
+		String feedbackChannel = FreeAtHomeESPapi::GetChannelString(feedback.Channel);
+		String feedbackDataPoint = FreeAtHomeESPapi::GetODPString(feedback.DataPoint);
+		this->NotifyCallback(FAHESPAPI_EVENT::FAHESPAPI_ON_DEVICE_EVENT, this->FahDevice, feedbackChannel.c_str(), feedbackDataPoint.c_str(), (void*)&Values[dp.Feedback]);
+	}
+}
+
+void FahESPGenericDevice::NotifyDeviceParameter(const String& strChannel, const uint16_t& Parameter, const String& strValue)
+{
+	uint8_t channel;
+	if (!ParseHexSuffix(strChannel, 2, channel))
+		return;
+
+	int16_t index = FindParameter(channel, Parameter);
+	if (index == FAH_SCHEMA_NOT_FOUND)
+		return;
+
+	ParameterValues[index] = strValue.toInt();
+	if (ParameterCallback != NULL)
+	{
+		ParameterCallback(this, Schema.Parameters[index], ParameterValues[index], ParameterCallbackContext);
+	}
+}
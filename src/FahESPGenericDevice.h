@@ -0,0 +1,59 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include "FahESPBuildConfig.h"
+#include "FahESPDevice.h"
+#include "FahDeviceSchema.h"
+
+class FreeAtHomeESPapi;
+class FahSysAPInfo;
+class FahESPGenericDevice;
+
+typedef void (*FAHESP_GENERIC_VALUE_CALLBACK)(FahESPGenericDevice* Device, const FahDataPointSchema& DataPoint, const float& Value, void* Context);
+typedef void (*FAHESP_GENERIC_PARAMETER_CALLBACK)(FahESPGenericDevice* Device, const FahParameterSchema& Parameter, const int32_t& Value, void* Context);
+
+#define FAH_SCHEMA_NOT_FOUND -1
+
+//Virtual device of which the channels, datapoints and parameters are declared by a FahDeviceSchema
+class FahESPGenericDevice: public FahESPDevice
+{
+public:
+	FahESPGenericDevice(const FahDeviceSchema& Schema, const uint64_t& FahAbbID, const String& SerialNr, const uint16_t& timeout, FreeAtHomeESPapi* fahParent, FahSysAPInfo* SysApInfo);
+	void process();
+	~FahESPGenericDevice();
+	void NotifyFahDataPoint(const String& strChannel, const String& strDataPoint, const String& strValue, const bool& isSceneOrGetValue);
+	void NotifyOnSysAPReconnect();
+	const FahDeviceSchema& GetSchema() { return Schema; };
+	int16_t FindDataPoint(const FAH_DATAPOINT_KEY& Key);
+	int16_t FindParameter(const uint8_t& Channel, const uint16_t& Parameter);
+	float GetValue(const uint8_t& Index);
+	int32_t GetParameterValue(const uint8_t& Index);
+	bool SetValue(const uint8_t& Index, const float& Value, FAHESP_DATAPOINT_CALLBACK Callback = NULL, void* Context = NULL);
+	void SetOnValueChanged(FAHESP_GENERIC_VALUE_CALLBACK Callback, void* Context = NULL) { ValueCallback = Callback; ValueCallbackContext = Context; };
+	void SetOnParameterChanged(FAHESP_GENERIC_PARAMETER_CALLBACK Callback, void* Context = NULL) { ParameterCallback = Callback; ParameterCallbackContext = Context; };
+	static bool ParseDataPointKey(const String& strChannel, const String& strDataPoint, FAH_DATAPOINT_KEY& Key);
+protected:
+	void NotifyDeviceParameter(const String& strChannel, const uint16_t& Parameter, const String& strValue);
+private:
+	const FahDeviceSchema& Schema;
+	float* Values = NULL;
+	int32_t* ParameterValues = NULL;
+	bool DataPointsSorted = false;
+	FAHESP_GENERIC_VALUE_CALLBACK ValueCallback = NULL;
+	void* ValueCallbackContext = NULL;
+	FAHESP_GENERIC_PARAMETER_CALLBACK ParameterCallback = NULL;
+	void* ParameterCallbackContext = NULL;
+	static bool ParseHexSuffix(const String& Value, const uint8_t& PrefixLength, uint8_t& Number);
+	String FormatValue(const FahDataPointSchema& DataPoint, const float& Value);
+	void UpdateValue(const uint8_t& Index, const float& Value);
+};
@@ -13,10 +13,13 @@
 #include "FahESPBuildConfig.h"
 #include "FahESPSwitchDevice.h"
 
-const String FahESPSwitchDevice::ConstStringDeviceType = "SwitchingActuator";
+constexpr char FahESPSwitchDevice::DeviceTypeName[] PROGMEM;
+const __FlashStringHelper* const FahESPSwitchDevice::ConstStringDeviceType = FPSTR(DeviceTypeName);
 
-FahESPSwitchDevice::FahESPSwitchDevice(const uint64_t& FahAbbID, const String& SerialNr, const uint16_t& timeout, FreeAtHomeESPapi* fahParent, FahSysAPInfo* SysApInfo):FahESPDevice(ConstStringDeviceType, FahAbbID, SerialNr, timeout, fahParent, SysApInfo)
+FahESPSwitchDevice::FahESPSwitchDevice(const uint64_t& FahAbbID, const String& SerialNr, const uint16_t& timeout, FreeAtHomeESPapi* fahParent, FahSysAPInfo* SysApInfo):FahESPDevice(String(ConstStringDeviceType), FahAbbID, SerialNr, timeout, fahParent, SysApInfo)
 {	
+	//Track the acknowledged output value to suppress redundant writes
+	TrackDataPointCompletion = true;
 	//Functionality identical when reconnect of SysAP
 	NotifyOnSysAPReconnect();
 }
@@ -32,16 +35,50 @@ bool FahESPSwitchDevice::GetState()
 }
 
 
-void FahESPSwitchDevice::SetState(bool isOn)
+void FahESPSwitchDevice::SetState(bool isOn, FAHESP_DATAPOINT_CALLBACK Callback, void* Context)
 {
+	UpdateState(isOn, true, Callback, Context);
+}
+
+void FahESPSwitchDevice::UpdateState(const bool& isOn, const bool& WriteOutput, FAHESP_DATAPOINT_CALLBACK Callback, void* Context)
+{
+	bool changed = !isStateKnown || this->isOn != isOn;
 	this->isOn = isOn;
-	String Body = FreeAtHomeESPapi::VALUE_0;
-	if (isOn)
+	isStateKnown = true;
+
+	int8_t state = isOn ? 1 : 0;
+	//No write when the SysAP has the value already or will get it from a queued write, unless the caller waits for completion
+	bool isAtSysAp = (PendingWrites > 0) ? (PendingState == state) : (AcknowledgedState == state);
+	if (WriteOutput && (Callback != NULL || !isAtSysAp))
+	{
+		String Body = FPSTR(isOn ? FreeAtHomeESPapi::VALUE_1 : FreeAtHomeESPapi::VALUE_0);
+		if (EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(0), FreeAtHomeESPapi::GetODPString(0), Body, Callback, Context))
+		{
+			PendingState = state;
+			PendingWrites++;
+		}
+	}
+
+	if (changed)
 	{
-		Body = FreeAtHomeESPapi::VALUE_1;
+		this->NotifyCallback(FAHESPAPI_EVENT::FAHESPAPI_ON_DEVICE_EVENT, this->FahDevice, FreeAtHomeESPapi::GetChannelString(0).c_str(), String(F("ON")).c_str(), (void*)isOn);
 	}
-	EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(0), FreeAtHomeESPapi::GetODPString(0), Body);
-	this->NotifyCallback(FAHESPAPI_EVENT::FAHESPAPI_ON_DEVICE_EVENT, this->FahDevice, FreeAtHomeESPapi::GetChannelString(0).c_str(), String(F("ON")).c_str(), (void*)isOn);
+}
+
+void FahESPSwitchDevice::NotifyDataPointResult(const FahDataPointResult& Result)
+{
+	if (Result.isGetValue || strcmp(Result.Channel, FreeAtHomeESPapi::GetChannelString(0).c_str()) != 0 || strcmp(Result.DataPoint, FreeAtHomeESPapi::GetODPString(0).c_str()) != 0)
+		return;
+
+	if (PendingWrites > 0)
+		PendingWrites--;
+	if (PendingWrites == 0)
+		PendingState = -1;
+
+	if (Result.Status == HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS)
+		AcknowledgedState = FahFlashString::Equals(Result.Value, FreeAtHomeESPapi::VALUE_0) ? 0 : 1;
+	else if (Result.Status != HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUPERSEDED)
+		AcknowledgedState = -1; //Not known what the SysAP has, write again on the next SetState
 }
 
 FahESPSwitchDevice::~FahESPSwitchDevice()
@@ -52,6 +89,7 @@ void FahESPSwitchDevice::NotifyOnSysAPReconnect()
 {
 	//Ensure to retrieve device state again after reconnect of SysAp
 	//Same procedure as after device registration
+	AcknowledgedState = -1;
 	EnqueGetDataPoint(FreeAtHomeESPapi::GetChannelString(0), FreeAtHomeESPapi::GetODPString(0));
 }
 
@@ -60,15 +98,19 @@ void FahESPSwitchDevice::NotifyFahDataPoint(const String& strChannel, const Stri
 	//DEBUG_P("VDN:");	DEBUG_P(strChannel); DEBUG_P("."); DEBUG_P(strDataPoint); DEBUG_P("=");	DEBUG_PL(strValue);
 	if (strChannel == FreeAtHomeESPapi::GetChannelString(0))
 	{
-		if (strDataPoint == FreeAtHomeESPapi::GetIDPString(0) || (isSceneOrGetValue && strDataPoint == FreeAtHomeESPapi::GetODPString(0)))
+		if (strDataPoint == FreeAtHomeESPapi::GetIDPString(0))
 		{
-			if (strValue == FreeAtHomeESPapi::VALUE_0)
-			{
-				SetState(false);
-			}
-			else
+			//Switched by the SysAP, report the new output value unless it is unchanged
+			UpdateState(!FahFlashString::Equals(strValue, FreeAtHomeESPapi::VALUE_0), true, NULL, NULL);
+		}
+		else if (isSceneOrGetValue && strDataPoint == FreeAtHomeESPapi::GetODPString(0))
+		{
+			//Output value as the SysAP has it, no need to write it back
+			//A queued write is newer than this value
+			if (PendingWrites == 0)
 			{
-				SetState(true);
+				AcknowledgedState = FahFlashString::Equals(strValue, FreeAtHomeESPapi::VALUE_0) ? 0 : 1;
+				UpdateState(AcknowledgedState == 1, false, NULL, NULL);
 			}
 		}
 	}
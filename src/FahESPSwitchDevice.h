@@ -24,13 +24,21 @@ public:
 	void process();
 	bool GetState();
 	~FahESPSwitchDevice();
-	static const String ConstStringDeviceType;
+	static constexpr char DeviceTypeName[] = "SwitchingActuator"; //In flash, compare with FahFlashString::Equals()
+	static const __FlashStringHelper* const ConstStringDeviceType; //DeviceTypeName, safe to pass as String
 	void NotifyFahDataPoint(const String& strChannel, const String& strDataPoint, const String& strValue, const bool& isSceneOrGetValue);
 	void NotifyOnSysAPReconnect();
-	void SetState(bool isOn);
+	void SetState(bool isOn, FAHESP_DATAPOINT_CALLBACK Callback = NULL, void* Context = NULL);
 	//void SetOnDeviceOnOffEvent(void(*callback)(FahESPSwitchDevice* Caller, const bool& isOn)) { CALLBACK_DEVICE_ONOFF_EVENT = callback; }
+protected:
+	void NotifyDataPointResult(const FahDataPointResult& Result);
 private:
 	//void(*CALLBACK_DEVICE_ONOFF_EVENT)(FahESPSwitchDevice* Caller, const bool& isOn) = NULL;
 	bool isOn = false;
+	bool isStateKnown = false;
+	int8_t AcknowledgedState = -1; //Output value as confirmed by the SysAP, -1 when unknown
+	int8_t PendingState = -1; //Output value of the last queued write, -1 when no write is queued
+	uint8_t PendingWrites = 0;
+	void UpdateState(const bool& isOn, const bool& WriteOutput, FAHESP_DATAPOINT_CALLBACK Callback, void* Context);
 
 };
\ No newline at end of file
@@ -13,9 +13,10 @@
 #include "FahESPWeatherStation.h"
 #include "FahParamDefinitions.h"
 
-const String FahESPWeatherStation::ConstStringDeviceType = "WeatherStation";
+constexpr char FahESPWeatherStation::DeviceTypeName[] PROGMEM;
+const __FlashStringHelper* const FahESPWeatherStation::ConstStringDeviceType = FPSTR(DeviceTypeName);
 
-FahESPWeatherStation::FahESPWeatherStation(const uint64_t& FahAbbID, const String& SerialNr, const uint16_t& timeout, FreeAtHomeESPapi* fahParent, FahSysAPInfo* SysApInfo):FahESPDevice(ConstStringDeviceType, FahAbbID, SerialNr, timeout, fahParent, SysApInfo)
+FahESPWeatherStation::FahESPWeatherStation(const uint64_t& FahAbbID, const String& SerialNr, const uint16_t& timeout, FreeAtHomeESPapi* fahParent, FahSysAPInfo* SysApInfo):FahESPDevice(String(ConstStringDeviceType), FahAbbID, SerialNr, timeout, fahParent, SysApInfo)
 {
 }
 
@@ -33,32 +34,36 @@ void FahESPWeatherStation::NotifyFahDataPoint(const String& strChannel, const St
 	//No events needed
 }
 
+constexpr FahParamHandler FahESPWeatherStation::ParameterHandlers[] =
+{
+	{ PID_FROST_ALARM_ACTIVATION_LEVEL, OnFrostAlarmLevel },
+	{ PID_WIND_FORCE, OnWindAlarmLevel },
+};
+
 void FahESPWeatherStation::NotifyDeviceParameter(const String& strChannel, const uint16_t& Parameter, const String& strValue)
 {
 	//DEBUG_P(String(F("NDP:"))); DEBUG_P(strChannel); DEBUG_P('>'); DEBUG_P(Parameter); DEBUG_P('>'); DEBUG_PL(strValue);
-	if(FreeAtHomeESPapi::GetChannelString(2) == strChannel)
+	static_assert(FahIsSortedByID(ParameterHandlers), "ParameterHandlers must be sorted by ID");
+	FahParamTable::Dispatch(ParameterHandlers, this, strChannel, Parameter, strValue);
+}
+
+void FahESPWeatherStation::OnFrostAlarmLevel(void* Context, const String& strChannel, const int32_t& Value)
+{
+	FahESPWeatherStation* station = (FahESPWeatherStation*)Context;
+	if (FreeAtHomeESPapi::GetChannelString(2) == strChannel && Value != station->alarmTemperature)
 	{
-		if(Parameter == PID_FROST_ALARM_ACTIVATION_LEVEL)
-		{
-			int lAlarmValue = strValue.toInt();
-			if (lAlarmValue != this->alarmTemperature)
-			{
-				DEBUG_PL(String(F("newTempAlarm")));
-				this->alarmTemperature = lAlarmValue;
-			}
-		}
+		DEBUG_PL(String(F("newTempAlarm")));
+		station->alarmTemperature = Value;
 	}
-	if (FreeAtHomeESPapi::GetChannelString(3) == strChannel)
+}
+
+void FahESPWeatherStation::OnWindAlarmLevel(void* Context, const String& strChannel, const int32_t& Value)
+{
+	FahESPWeatherStation* station = (FahESPWeatherStation*)Context;
+	if (FreeAtHomeESPapi::GetChannelString(3) == strChannel && Value != station->alarmWindForce)
 	{
-		if (Parameter == PID_WIND_FORCE)
-		{
-			int lAlarmValue = strValue.toInt();
-			if (lAlarmValue != this->alarmWindForce)
-			{
-				DEBUG_PL(String(F("newWindAlarm")));
-				this->alarmWindForce = lAlarmValue;
-			}
-		}
+		DEBUG_PL(String(F("newWindAlarm")));
+		station->alarmWindForce = Value;
 	}
 }
 
@@ -77,68 +82,25 @@ void FahESPWeatherStation::SetBrightnessLevelByAnalogSensor(const uint8_t &Pin)
 
 void FahESPWeatherStation::SetBrightnessLevelLux(const uint16_t &level, const bool &forceupdate)
 {
-	if (!forceupdate && level == lvBrightness)
-		return;
-	else
-	{
-		//Level
-		String Body1 = String(level);
-		if (EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(0), FreeAtHomeESPapi::GetODPString(1), Body1))
-		{
-			lvBrightness = level;
-		}
-	}
+	ReportSensorValue(FAH_WEATHER_SENSORS::FAH_WS_BRIGHTNESS, level, forceupdate);
 }
 
 void FahESPWeatherStation::SetRainInformation(const float &amount_of_rain, const bool &isRaining, const bool& forceupdate)
 {
-	if (!forceupdate && lvRain == amount_of_rain && this->lvIsRaining == isRaining)
-		return;
-	else
-	{
-		//Alarm
-		String Body1 = FreeAtHomeESPapi::VALUE_0;
-		if (amount_of_rain > 0 || isRaining)
-		{
-			Body1 = FreeAtHomeESPapi::VALUE_1;
-			this->lvIsRaining = true;
-		}
-		else
-		{
-			this->lvIsRaining = false;
-		}
-		EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(1), FreeAtHomeESPapi::GetODPString(0), Body1);
+	//Alarm
+	SendAlarm(1, amount_of_rain > 0 || isRaining, RainAlarm, forceupdate);
 
-		//Rain
-		String Body2 = String(amount_of_rain);
-		if (EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(1), FreeAtHomeESPapi::GetODPString(2), Body2))
-		{
-			lvRain = amount_of_rain;
-		}
-	}
+	//Rain
+	ReportSensorValue(FAH_WEATHER_SENSORS::FAH_WS_RAIN, amount_of_rain, forceupdate);
 }
 
 void FahESPWeatherStation::SetTemperatureLevel(const float &MessuredTemp, const bool& forceupdate)
 {
-	if (!forceupdate && lvTemperature == MessuredTemp)
-		return;
-	else
-	{
-		//Alarm
-		String Body1 = FreeAtHomeESPapi::VALUE_0;
-		if (MessuredTemp <= alarmTemperature)
-		{
-			Body1 = FreeAtHomeESPapi::VALUE_1;
-		}
-		EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(2), FreeAtHomeESPapi::GetODPString(0), Body1);
+	//Alarm
+	SendAlarm(2, GetFrostAlarm(MessuredTemp), FrostAlarm, forceupdate);
 
-		//Value
-		String Body2 = String(MessuredTemp);
-		if (EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(2), FreeAtHomeESPapi::GetODPString(1), Body2))
-		{
-			lvTemperature = MessuredTemp;
-		}
-	}
+	//Value
+	ReportSensorValue(FAH_WEATHER_SENSORS::FAH_WS_TEMPERATURE, MessuredTemp, forceupdate);
 }
 
 void FahESPWeatherStation::SetWindSpeed(const uint8_t& speedBeaufort, const float& SpeedGustsMS, const bool& forceupdate)
@@ -149,48 +111,215 @@ void FahESPWeatherStation::SetWindSpeed(const uint8_t& speedBeaufort, const floa
 
 void FahESPWeatherStation::SetWindAlarm(const bool& AlarmActive)
 {
-	//Alarm
-	String Body1 = FreeAtHomeESPapi::VALUE_0;
-	if (AlarmActive)
+	SendAlarm(3, AlarmActive, WindAlarm, true);
+}
+
+void FahESPWeatherStation::SetWindSpeedBeaufort(const uint8_t& SpeedBeaufort, const bool& forceupdate)
+{
+	if (manualWindAlarmCreation)
 	{
-		Body1 = FreeAtHomeESPapi::VALUE_1;
+		//Alarm
+		SendAlarm(3, GetWindAlarm(SpeedBeaufort), WindAlarm, forceupdate);
 	}
-	EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(3), FreeAtHomeESPapi::GetODPString(0), Body1);
 
+	//Speed
+	ReportSensorValue(FAH_WEATHER_SENSORS::FAH_WS_WIND_FORCE, SpeedBeaufort, forceupdate);
 }
 
-void FahESPWeatherStation::SetWindSpeedBeaufort(const uint8_t& SpeedBeaufort, const bool& forceupdate)
+void FahESPWeatherStation::SetWindGustSpeed(const float& SpeedGustsMS, const bool& forceupdate)
+{
+	//Speed M/S
+	ReportSensorValue(FAH_WEATHER_SENSORS::FAH_WS_WIND_GUST, SpeedGustsMS, forceupdate);
+}
+
+void FahESPWeatherStation::SetReportFilter(const FAH_WEATHER_SENSOR& Sensor, const float& AbsoluteDeadband, const float& RelativeDeadband, const unsigned long& MinIntervalMs, const unsigned long& MaxIntervalMs)
 {
-	if (!forceupdate && uWindSpeedBeaufort != SpeedBeaufort)
+	if (Sensor >= FAH_WEATHER_SENSORS::FAH_WS_SENSOR_COUNT)
+		return;
+
+	Filters[Sensor].Configure(AbsoluteDeadband, RelativeDeadband, MinIntervalMs, MaxIntervalMs);
+	ScheduleReportTimer();
+}
+
+void FahESPWeatherStation::SetAlarmHysteresis(const float& Temperature, const uint8_t& WindForce)
+{
+	TemperatureAlarmHysteresis = Temperature;
+	WindAlarmHysteresis = WindForce;
+}
+
+bool FahESPWeatherStation::GetFrostAlarm(const float& Temperature)
+{
+	//Once active it only clears above the activation level plus the hysteresis
+	if (FrostAlarm == 1)
+		return Temperature <= alarmTemperature + TemperatureAlarmHysteresis;
+	return Temperature <= alarmTemperature;
+}
+
+bool FahESPWeatherStation::GetWindAlarm(const uint8_t& SpeedBeaufort)
+{
+	//Once active it only clears below the activation level minus the hysteresis
+	if (WindAlarm == 1)
+		return SpeedBeaufort + WindAlarmHysteresis >= alarmWindForce;
+	return SpeedBeaufort >= alarmWindForce;
+}
+
+bool FahESPWeatherStation::Update(const FahWeatherUpdate& Measurements, const bool& forceupdate)
+{
+	//Collect what changed first, in channel order with the alarm before the values of a channel
+	struct PlannedWrite
+	{
+		int8_t Sensor; //-1 for an alarm
+		uint8_t Channel;
+		bool AlarmActive;
+		float Value;
+	};
+	PlannedWrite planned[8];
+	uint8_t count = 0;
+
+	if (Measurements.has(FAH_WEATHER_SENSORS::FAH_WS_BRIGHTNESS) && Filters[FAH_WEATHER_SENSORS::FAH_WS_BRIGHTNESS].Offer(Measurements.BrightnessLux, forceupdate))
+	{
+		planned[count++] = { FAH_WEATHER_SENSORS::FAH_WS_BRIGHTNESS, 0, false, (float)Measurements.BrightnessLux };
+	}
+	if (Measurements.has(FAH_WEATHER_SENSORS::FAH_WS_RAIN))
+	{
+		bool alarmActive = Measurements.AmountOfRain > 0 || Measurements.isRaining;
+		if (forceupdate || isAlarmChanged(RainAlarm, alarmActive))
+			planned[count++] = { -1, 1, alarmActive, 0 };
+		if (Filters[FAH_WEATHER_SENSORS::FAH_WS_RAIN].Offer(Measurements.AmountOfRain, forceupdate))
+			planned[count++] = { FAH_WEATHER_SENSORS::FAH_WS_RAIN, 1, false, Measurements.AmountOfRain };
+	}
+	if (Measurements.has(FAH_WEATHER_SENSORS::FAH_WS_TEMPERATURE))
 	{
-		if (manualWindAlarmCreation)
+		bool alarmActive = GetFrostAlarm(Measurements.Temperature);
+		if (forceupdate || isAlarmChanged(FrostAlarm, alarmActive))
+			planned[count++] = { -1, 2, alarmActive, 0 };
+		if (Filters[FAH_WEATHER_SENSORS::FAH_WS_TEMPERATURE].Offer(Measurements.Temperature, forceupdate))
+			planned[count++] = { FAH_WEATHER_SENSORS::FAH_WS_TEMPERATURE, 2, false, Measurements.Temperature };
+	}
+	if (Measurements.has(FAH_WEATHER_SENSORS::FAH_WS_WIND_FORCE))
+	{
+		bool alarmActive = GetWindAlarm(Measurements.WindForceBeaufort);
+		if (manualWindAlarmCreation && (forceupdate || isAlarmChanged(WindAlarm, alarmActive)))
+			planned[count++] = { -1, 3, alarmActive, 0 };
+		if (Filters[FAH_WEATHER_SENSORS::FAH_WS_WIND_FORCE].Offer(Measurements.WindForceBeaufort, forceupdate))
+			planned[count++] = { FAH_WEATHER_SENSORS::FAH_WS_WIND_FORCE, 3, false, (float)Measurements.WindForceBeaufort };
+	}
+	if (Measurements.has(FAH_WEATHER_SENSORS::FAH_WS_WIND_GUST) && Filters[FAH_WEATHER_SENSORS::FAH_WS_WIND_GUST].Offer(Measurements.WindGustMS, forceupdate))
+	{
+		planned[count++] = { FAH_WEATHER_SENSORS::FAH_WS_WIND_GUST, 3, false, Measurements.WindGustMS };
+	}
+
+	//All or nothing, a sweep is never sent halfway
+	if (count > GetFreeDatapointSlots())
+		return false;
+
+	for (uint8_t i = 0; i < count; i++)
+	{
+		if (planned[i].Sensor < 0)
 		{
-			//Alarm
-			if (SpeedBeaufort >= alarmWindForce)
-			{
-				SetWindAlarm(true);
-			}
-			SetWindAlarm(false);
+			int8_t& alarmState = planned[i].Channel == 1 ? RainAlarm : (planned[i].Channel == 2 ? FrostAlarm : WindAlarm);
+			SendAlarm(planned[i].Channel, planned[i].AlarmActive, alarmState, true);
 		}
-
-		//Speed
-		String Body2 = String(SpeedBeaufort);
-		if (EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(3), FreeAtHomeESPapi::GetODPString(1), Body2))
+		else
 		{
-			uWindSpeedBeaufort = SpeedBeaufort;
+			SendSensorValue((FAH_WEATHER_SENSOR)planned[i].Sensor, planned[i].Value);
 		}
 	}
+	ScheduleReportTimer();
+	return true;
 }
 
-void FahESPWeatherStation::SetWindGustSpeed(const float& SpeedGustsMS, const bool& forceupdate)
+bool FahESPWeatherStation::SendAlarm(const uint8_t& Channel, const bool& AlarmActive, int8_t& AlarmState, const bool& forceupdate)
+{
+	//Alarms are sent on change only, without deadband or minimum interval
+	if (!forceupdate && !isAlarmChanged(AlarmState, AlarmActive))
+		return false;
+
+	String Body = FPSTR(AlarmActive ? FreeAtHomeESPapi::VALUE_1 : FreeAtHomeESPapi::VALUE_0);
+	if (EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(Channel), FreeAtHomeESPapi::GetODPString(0), Body))
+	{
+		AlarmState = AlarmActive ? 1 : 0;
+		return true;
+	}
+	return false;
+}
+
+bool FahESPWeatherStation::SendSensorValue(const FAH_WEATHER_SENSOR& Sensor, const float& Value)
+{
+	bool enqueued = false;
+	switch (Sensor)
+	{
+		case FAH_WEATHER_SENSORS::FAH_WS_BRIGHTNESS:
+			enqueued = EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(0), FreeAtHomeESPapi::GetODPString(1), String((uint16_t)Value));
+			break;
+		case FAH_WEATHER_SENSORS::FAH_WS_RAIN:
+			enqueued = EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(1), FreeAtHomeESPapi::GetODPString(2), String(Value));
+			break;
+		case FAH_WEATHER_SENSORS::FAH_WS_TEMPERATURE:
+			enqueued = EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(2), FreeAtHomeESPapi::GetODPString(1), String(Value));
+			break;
+		case FAH_WEATHER_SENSORS::FAH_WS_WIND_FORCE:
+			enqueued = EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(3), FreeAtHomeESPapi::GetODPString(1), String((uint8_t)Value));
+			break;
+		case FAH_WEATHER_SENSORS::FAH_WS_WIND_GUST:
+			enqueued = EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(3), FreeAtHomeESPapi::GetODPString(3), String(Value, 2));
+			break;
+		default:
+			return false;
+	}
+	if (enqueued)
+	{
+		Filters[Sensor].Reported(Value);
+	}
+	return enqueued;
+}
+
+void FahESPWeatherStation::ReportSensorValue(const FAH_WEATHER_SENSOR& Sensor, const float& Value, const bool& forceupdate)
 {
-	if (!forceupdate && WindSpeedMS != SpeedGustsMS)
+	if (Filters[Sensor].Offer(Value, forceupdate))
 	{
-		//Speed M/S
-		String Body3 = String(SpeedGustsMS, 2);
-		if (EnqueSetDataPoint(FreeAtHomeESPapi::GetChannelString(3), FreeAtHomeESPapi::GetODPString(3), Body3))
+		SendSensorValue(Sensor, Value);
+	}
+	ScheduleReportTimer();
+}
+
+void FahESPWeatherStation::SendDueReports()
+{
+	for (uint8_t i = 0; i < FAH_WEATHER_SENSORS::FAH_WS_SENSOR_COUNT; i++)
+	{
+		float value;
+		if (Filters[i].isDue(value) && !SendSensorValue((FAH_WEATHER_SENSOR)i, value))
 		{
-			WindSpeedMS = SpeedGustsMS;
+			//Queue is full, do not retry right away
+			Filters[i].Postpone();
 		}
 	}
+	ScheduleReportTimer();
+}
+
+void FahESPWeatherStation::ScheduleReportTimer()
+{
+	unsigned long nextMs = (unsigned long)-1;
+	for (uint8_t i = 0; i < FAH_WEATHER_SENSORS::FAH_WS_SENSOR_COUNT; i++)
+	{
+		unsigned long dueMs = Filters[i].MillisUntilDue();
+		if (dueMs < nextMs)
+			nextMs = dueMs;
+	}
+
+	SysApApi->GetTimerQueue().Cancel(ReportTimer);
+	if (nextMs != (unsigned long)-1)
+	{
+		//Due reports are sent from the timer, never fire it twice in the same pass
+		if (nextMs == 0)
+			nextMs = 1;
+		ReportTimer = SysApApi->GetTimerQueue().Schedule(nextMs, OnReportTimer, this, 0);
+	}
+}
+
+void FahESPWeatherStation::OnReportTimer(void* Context, const uint8_t& TimerID)
+{
+	FahESPWeatherStation* station = (FahESPWeatherStation*)Context;
+	station->ReportTimer = 0;
+	station->SendDueReports();
 }
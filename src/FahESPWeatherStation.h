@@ -13,10 +13,44 @@
 #pragma once
 #include "FahESPBuildConfig.h"
 #include "FahESPDevice.h"
+#include "FahReportFilter.h"
+#include "FahParamTable.h"
 
 class FreeAtHomeESPapi;
 class FahSysAPInfo;
 
+namespace FAH_WEATHER_SENSORS
+{
+	enum FAH_WEATHER_SENSOR :uint8_t
+	{
+		FAH_WS_BRIGHTNESS = 0,
+		FAH_WS_RAIN = 1,
+		FAH_WS_TEMPERATURE = 2,
+		FAH_WS_WIND_FORCE = 3,
+		FAH_WS_WIND_GUST = 4,
+		FAH_WS_SENSOR_COUNT
+	};
+}
+typedef FAH_WEATHER_SENSORS::FAH_WEATHER_SENSOR FAH_WEATHER_SENSOR;
+
+//All measurements of one sensor sweep, only the values that are set are sent
+struct FahWeatherUpdate
+{
+	uint8_t Fields = 0; //Bit per FAH_WEATHER_SENSOR
+	uint16_t BrightnessLux = 0;
+	float AmountOfRain = 0;
+	bool isRaining = false;
+	float Temperature = 0;
+	uint8_t WindForceBeaufort = 0;
+	float WindGustMS = 0;
+	void SetBrightnessLux(const uint16_t& Level) { BrightnessLux = Level; Fields |= 1 << FAH_WEATHER_SENSORS::FAH_WS_BRIGHTNESS; };
+	void SetRain(const float& Amount, const bool& Raining) { AmountOfRain = Amount; isRaining = Raining; Fields |= 1 << FAH_WEATHER_SENSORS::FAH_WS_RAIN; };
+	void SetTemperature(const float& Value) { Temperature = Value; Fields |= 1 << FAH_WEATHER_SENSORS::FAH_WS_TEMPERATURE; };
+	void SetWindForce(const uint8_t& Beaufort) { WindForceBeaufort = Beaufort; Fields |= 1 << FAH_WEATHER_SENSORS::FAH_WS_WIND_FORCE; };
+	void SetWindGust(const float& SpeedMS) { WindGustMS = SpeedMS; Fields |= 1 << FAH_WEATHER_SENSORS::FAH_WS_WIND_GUST; };
+	bool has(const FAH_WEATHER_SENSOR& Sensor) const { return (Fields & (1 << Sensor)) != 0; };
+};
+
 class FahESPWeatherStation: public FahESPDevice
 {
 public:
@@ -24,7 +58,8 @@ public:
 	FahESPWeatherStation(const uint64_t& FahAbbID, const String& SerialNr, const uint16_t& timeout, FreeAtHomeESPapi* fahParent, FahSysAPInfo* SysApInfo);
 	void process();
 	~FahESPWeatherStation();
-	static const String ConstStringDeviceType;
+	static constexpr char DeviceTypeName[] = "WeatherStation"; //In flash, compare with FahFlashString::Equals()
+	static const __FlashStringHelper* const ConstStringDeviceType; //DeviceTypeName, safe to pass as String
 	void NotifyFahDataPoint(const String& strChannel, const String& strDataPoint, const String& strValue, const bool& isSceneOrGetValue);
 	void NotifyDeviceParameter(const String& strChannel, const uint16_t& Parameter, const String& strValue);
 	void SetBrightnessLevelWM2(const uint16_t &level);
@@ -36,13 +71,37 @@ public:
 	void SetWindSpeedBeaufort(const uint8_t& SpeedBeaufort, const bool& forceupdate = false);
 	void SetWindAlarm(const bool& AlarmActive);
 	void SetWindGustSpeed(const float& SpeedGustsMS, const bool& forceupdate = false);
+	bool Update(const FahWeatherUpdate& Measurements, const bool& forceupdate = false);
+	void SetReportFilter(const FAH_WEATHER_SENSOR& Sensor, const float& AbsoluteDeadband, const float& RelativeDeadband, const unsigned long& MinIntervalMs, const unsigned long& MaxIntervalMs);
+	void SetAlarmHysteresis(const float& Temperature, const uint8_t& WindForce);
 private:
-	float lvRain = -1;
-	bool lvIsRaining = false;
-	float lvTemperature = -60;
-	uint16_t lvBrightness = 0xFFFF;
-	float WindSpeedMS = -1;
-	uint8_t uWindSpeedBeaufort = 0xFF;
+	FahReportFilter Filters[FAH_WEATHER_SENSORS::FAH_WS_SENSOR_COUNT] =
+	{
+		FahReportFilter(0, FAH_WS_BRIGHTNESS_DEADBAND, FAH_WS_MIN_REPORT_INTERVAL_MS, FAH_WS_HEARTBEAT_INTERVAL_MS),
+		FahReportFilter(FAH_WS_RAIN_DEADBAND, 0, FAH_WS_MIN_REPORT_INTERVAL_MS, FAH_WS_HEARTBEAT_INTERVAL_MS),
+		FahReportFilter(FAH_WS_TEMPERATURE_DEADBAND, 0, FAH_WS_MIN_REPORT_INTERVAL_MS, FAH_WS_HEARTBEAT_INTERVAL_MS),
+		FahReportFilter(0, 0, FAH_WS_MIN_REPORT_INTERVAL_MS, FAH_WS_HEARTBEAT_INTERVAL_MS),
+		FahReportFilter(FAH_WS_WIND_GUST_DEADBAND, 0, FAH_WS_MIN_REPORT_INTERVAL_MS, FAH_WS_HEARTBEAT_INTERVAL_MS),
+	};
+	//Alarm states as last sent, -1 before the first send
+	int8_t RainAlarm = -1;
+	int8_t FrostAlarm = -1;
+	int8_t WindAlarm = -1;
+	float TemperatureAlarmHysteresis = FAH_WS_TEMPERATURE_ALARM_HYSTERESIS;
+	uint8_t WindAlarmHysteresis = FAH_WS_WIND_ALARM_HYSTERESIS;
 	int alarmTemperature = 3;
 	int alarmWindForce = 5;
-};
\ No newline at end of file
+	FAH_TIMER_HANDLE ReportTimer = 0;
+	bool SendSensorValue(const FAH_WEATHER_SENSOR& Sensor, const float& Value);
+	void ReportSensorValue(const FAH_WEATHER_SENSOR& Sensor, const float& Value, const bool& forceupdate);
+	bool SendAlarm(const uint8_t& Channel, const bool& AlarmActive, int8_t& AlarmState, const bool& forceupdate);
+	static bool isAlarmChanged(const int8_t& AlarmState, const bool& AlarmActive) { return AlarmState != (AlarmActive ? 1 : 0); };
+	bool GetFrostAlarm(const float& Temperature);
+	bool GetWindAlarm(const uint8_t& SpeedBeaufort);
+	void SendDueReports();
+	void ScheduleReportTimer();
+	static void OnReportTimer(void* Context, const uint8_t& TimerID);
+	static const FahParamHandler ParameterHandlers[];
+	static void OnFrostAlarmLevel(void* Context, const String& strChannel, const int32_t& Value);
+	static void OnWindAlarmLevel(void* Context, const String& strChannel, const int32_t& Value);
+};
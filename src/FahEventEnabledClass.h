@@ -23,6 +23,7 @@ namespace FAHESPAPI_EVENTS
 		FAHESPAPI_ON_DATAPOINT = 2,
 		FAHESPAPI_ON_DEVICE_EVENT = 3,
 		FAHESPAPI_ON_DISPLAYNAME = 4,
+		FAHESPAPI_ON_REQUEST_DEADLETTER = 5, //Datapoint request dropped after its retries, ptrValue is the value as char*
 	};
 }
 
@@ -0,0 +1,42 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include <Arduino.h>
+
+//Protocol constants are stored as char arrays in flash (PROGMEM), their length is known at compile time.
+//Wrap them with FPSTR() when passing them to String or ArduinoJson.
+class FahFlashString
+{
+public:
+	template<size_t N> static constexpr size_t Length(const char (&)[N]) { return N - 1; }
+
+	//Lengths are compared first, the characters only when the lengths match
+	template<size_t N> static bool Equals(const char* Value, const size_t& ValueLength, const char (&FlashString)[N])
+	{
+		if (ValueLength != N - 1)
+			return false;
+		return Value != NULL && memcmp_P(Value, FlashString, N - 1) == 0;
+	}
+
+	template<size_t N> static bool Equals(const String& Value, const char (&FlashString)[N])
+	{
+		return Equals(Value.c_str(), Value.length(), FlashString);
+	}
+
+	template<size_t N> static bool Equals(const char* Value, const char (&FlashString)[N])
+	{
+		if (Value == NULL)
+			return false;
+		return strncmp_P(Value, FlashString, N) == 0;
+	}
+};
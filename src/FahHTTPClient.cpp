@@ -33,32 +33,55 @@ void FahHTTPClient::ReleaseAsync()
 	Async_Method = "";
 	Async_URI = "";
 	Async_PostData = "";
+	Async_ResultCode = 0;
 	AsyncStatus = HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_NONE;	
 }
 
-FahHTTPClient::FahHTTPClient(FahSysAPInfo* sysApInfo) :HTTPClient(sysApInfo->secure)
+FahHTTPClient::FahHTTPClient(FahSysAPInfo* sysApInfo, const FahCapacities& Capacities) :HTTPClient(sysApInfo->secure, Capacities.MaxBodySize, Capacities.RequestBufferSize, Capacities.HeaderLineSize)
 {
 	this->SysAp = sysApInfo;
+	this->SetStaticRequestHeaders(&sysApInfo->RequestHeaders);
 }
 
 bool FahHTTPClient::ConnectToSysAp()
 {
 	if (this->GetState() <= HTTPCLIENT_STATE::HTTPCLIENT_STATE_CLOSED)
 	{
-		if (!this->Connect(this->SysAp->Hostname.c_str(), this->SysAp->port))
+		//Connect is blocking, do not attempt it while the SysAP is known to be down
+		if (!this->SysAp->ConnectBreaker.AllowConnect())
 		{
+			return false;
+		}
+
+		IPAddress address;
+		if (!this->SysAp->ResolveAddress(address) || !this->Connect(address, this->SysAp->port))
+		{
+			//Address may have changed, look it up again on the next attempt
+			this->SysAp->InvalidateAddress();
+			this->SysAp->ConnectBreaker.RecordFailure();
 			this->abort();
 			return false;
 		}
 		else
 		{
+			this->SysAp->ConnectBreaker.RecordSuccess();
 			return true;
 		}
 	}
 	return false;
 }
 
-bool FahHTTPClient::HTTPRequestAsync(const String& Method, const String& URI, const String& PostData)
+bool FahHTTPClient::isSysApAvailable()
+{
+	return this->SysAp->ConnectBreaker.isConnectAllowed();
+}
+
+unsigned long FahHTTPClient::MillisUntilSysApAvailable()
+{
+	return this->SysAp->ConnectBreaker.MillisUntilProbe();
+}
+
+bool FahHTTPClient::HTTPRequestAsync(const String& Method, const String& URI, const String& PostData, HTTPBodySink* BodySink)
 {
 	if (AsyncStatus != HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING)
 	{
@@ -70,6 +93,8 @@ bool FahHTTPClient::HTTPRequestAsync(const String& Method, const String& URI, co
 		Async_Method = Method;
 		Async_URI = URI;
 		Async_PostData = PostData;
+		SetBodySink(BodySink);
+		Async_ResultCode = 0;
 		AsyncStatus = HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING;
 		return true;
 	}
@@ -93,6 +118,7 @@ void FahHTTPClient::ProcessAsync()
 
 		case HTTPCLIENT_STATE::HTTPCLIENT_STATE_FAILED:
 			AsyncStatus = HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED;
+			//fall through
 
 		case HTTPCLIENT_STATE::HTTPCLIENT_STATE_CONNECTED:
 			if (!PutHTTPRequest(Async_Method, Async_URI, Async_PostData))
@@ -109,9 +135,13 @@ void FahHTTPClient::ProcessAsync()
 			}
 			else if (reqStatus != HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS)
 			{
+				//Non 200 status, the connection is closed already and must not be reported as success
 				DEBUG_PL(F("ASYNC_HTTP Response Failed"));
+				AsyncStatus = HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED;
+				return;
 			}
-			return;
+			//Status line received, continue with the headers in the same pass
+			//fall through
 
 		case HTTPCLIENT_STATE::HTTPCLIENT_STATE_HEADERS:
 			reqStatus = ProcessHTTPHeaders();
@@ -122,8 +152,11 @@ void FahHTTPClient::ProcessAsync()
 			else if(reqStatus != HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS)
 			{
 				DEBUG_PL(F("ASYNC_HTTP Headers Failed"));
+				AsyncStatus = HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED;
+				return;
 			}
-			return;
+			//Headers complete, continue with the body in the same pass
+			//fall through
 
 		case HTTPCLIENT_STATE::HTTPCLIENT_STATE_DATA:
 			reqStatus = ProcessHTTPBody();
@@ -135,6 +168,7 @@ void FahHTTPClient::ProcessAsync()
 			else if (reqStatus != HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS)
 			{
 				DEBUG_PL(F("ASYNC_HTTP Data Failed"));
+				AsyncStatus = HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED;
 			}
 			else
 			{
@@ -208,15 +242,7 @@ bool FahHTTPClient::PutHTTPRequest(const String& Method, const String& URI, cons
 {
 	if (this->GetState() == HTTPCLIENT_STATE::HTTPCLIENT_STATE_CONNECTED)
 	{
-		String appjson = String(F("application/json"));
-		this->AddRequestHeader(String(F("Content-Type")), appjson);
-		this->AddRequestHeader(String(F("Accept")), appjson);
-		this->AddRequestHeader(String(F("Host")), String(F("sysap")));
-		if (this->SysAp->authorizationHeader.length() != 0)
-		{
-			this->AddRequestHeader(String(F("Authorization")), this->SysAp->authorizationHeader);
-		}
-
+		//Content-Type, Accept, Host and Authorization come from the header block of the SysAP session
 		if (!this->Request(Method, URI, PostData))
 		{
 			this->abort();
@@ -234,16 +260,14 @@ HTTPREQUEST_STATUS FahHTTPClient::ProcessHTTPHeaders()
 {
 	if (this->GetState() == HTTPCLIENT_STATE::HTTPCLIENT_STATE_HEADERS)
 	{
-		String Key;
-		String Value;
-		if (this->ReadHeaders(Key, Value))
+		this->ReadHeaders();
+		if (this->GetState() == HTTPCLIENT_STATE::HTTPCLIENT_STATE_DATA)
 		{
-			//DEBUG_P("hdr: "); DEBUG_P(Key);	DEBUG_P("-->"); DEBUG_PL(Value);
-			return HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING;
+			return HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS;
 		}
-		else
+		else if (this->GetState() == HTTPCLIENT_STATE::HTTPCLIENT_STATE_HEADERS)
 		{
-			return HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS;
+			return HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING;
 		}
 	}
 	return HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_FAILED;
@@ -254,7 +278,10 @@ HTTPREQUEST_STATUS FahHTTPClient::ProcessHTTPBody()
 	if (this->GetState() == HTTPCLIENT_STATE::HTTPCLIENT_STATE_DATA)
 	{
 		this->ReadPayload();
-		return HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING;
+		if (this->GetState() == HTTPCLIENT_STATE::HTTPCLIENT_STATE_DATA)
+		{
+			return HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING;
+		}
 	}
 
 	if (this->GetState() == HTTPCLIENT_STATE::HTTPCLIENT_STATE_CLOSED)
@@ -271,6 +298,7 @@ HTTPREQUEST_STATUS FahHTTPClient::GetHTTPRequestResult()
 		uint16_t resultcode = 0xFFFF;
 		if (this->ReadResult(&resultcode))
 		{
+			Async_ResultCode = resultcode;
 			if (resultcode != 200)
 			{
 				DEBUG_P(F("DeviceFailed: HTTP_STATUS_"));
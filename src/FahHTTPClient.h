@@ -14,6 +14,7 @@
 #include "FahESPBuildConfig.h"
 #include "HTTPClient.h"
 #include "FahSysAPInfo.h"
+#include "FahCapacityPolicy.h"
 
 namespace HTTPREQUEST_STATUSUS
 {
@@ -24,6 +25,7 @@ namespace HTTPREQUEST_STATUSUS
 		HTTPREQUEST_STATUS_FAILED = 2,
 		HTTPREQUEST_STATUS_TIMEOUT = 3,
 		HTTPREQUEST_STATUS_PENDING = 4,
+		HTTPREQUEST_STATUS_SUPERSEDED = 5, //Datapoint write replaced by a newer value before it was acknowledged
 	};
 }
 typedef HTTPREQUEST_STATUSUS::HTTPREQUEST_STATUS HTTPREQUEST_STATUS;
@@ -40,13 +42,17 @@ private:
 	String Async_URI;
 	String Async_PostData;
 	String Async_Method;
+	uint16_t Async_ResultCode = 0;
 	HTTPREQUEST_STATUS AsyncStatus = HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_NONE;
 public:
 	String LastURIRequested();
 	String LastRequestMethod();
 	HTTPREQUEST_STATUS GetAsyncStatus();
-	FahHTTPClient(FahSysAPInfo* sysApInfo);
-	bool HTTPRequestAsync(const String& Method, const String& URI, const String& PostData);
+	bool isSysApAvailable();
+	unsigned long MillisUntilSysApAvailable();
+	uint16_t GetLastResultCode() { return Async_ResultCode; };
+	FahHTTPClient(FahSysAPInfo* sysApInfo, const FahCapacities& Capacities = FahCapacitiesOf<FahDefaultCapacityPolicy>());
+	bool HTTPRequestAsync(const String& Method, const String& URI, const String& PostData, HTTPBodySink* BodySink = NULL); //BodySink receives the body instead of GetBody()
 	void ProcessAsync();
 	void ReleaseAsync();
 	bool HTTPRequest(const String& URI, const String& Method, const String& PostData);
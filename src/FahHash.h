@@ -0,0 +1,31 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include <Arduino.h>
+
+#define FAH_HASH_INIT 2166136261UL //FNV-1a 32 bit offset basis
+#define FAH_HASH_PRIME 16777619UL
+
+inline uint32_t FahHashByte(const uint32_t& Hash, const uint8_t& Byte)
+{
+	return (Hash ^ Byte) * FAH_HASH_PRIME;
+}
+
+inline uint32_t FahHashString(const char* Str, uint32_t Hash = FAH_HASH_INIT)
+{
+	while (*Str != 0)
+	{
+		Hash = FahHashByte(Hash, (uint8_t)*Str++);
+	}
+	return Hash;
+}
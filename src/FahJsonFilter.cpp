@@ -0,0 +1,289 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahJsonFilter.h"
+
+static bool isJsonSpace(const char& c)
+{
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+FahJsonFilter::FahJsonFilter(const uint16_t& MaxOutputSize)
+{
+	this->MaxOutputSize = MaxOutputSize;
+}
+
+bool FahJsonFilter::AddPath(const String& Path)
+{
+	if (PathCount >= FAH_JSON_FILTER_MAX_PATHS || Path.length() == 0)
+		return false;
+
+	//The document is the value at the start of every path
+	Paths[PathCount] = Path;
+	ValuePaths |= (1 << PathCount);
+	PathCount++;
+	return true;
+}
+
+bool FahJsonFilter::Write(const uint8_t* Data, const size_t& Length)
+{
+	for (size_t i = 0; i < Length && State != FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_ERROR && !OutputFull; i++)
+	{
+		Process((char)Data[i]);
+	}
+	return State != FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_ERROR && !OutputFull;
+}
+
+void FahJsonFilter::Process(const char& c)
+{
+	switch (State)
+	{
+		case FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_VALUE:
+			if (!isJsonSpace(c))
+				StartValue(c);
+			return;
+
+		case FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_KEY_OR_END:
+			if (isJsonSpace(c))
+				return;
+			if (c == '"')
+			{
+				KeyLength = 0;
+				KeyTooLong = false;
+				KeyEscape = false;
+				State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_KEY;
+			}
+			else if (c == '}')
+				EndObject();
+			else
+				State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_ERROR;
+			return;
+
+		case FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_KEY:
+			if (!KeyEscape && c == '"')
+			{
+				State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_COLON;
+				return;
+			}
+			//Escapes are kept as written, path keys do not contain them
+			KeyEscape = !KeyEscape && c == '\\';
+			if (KeyLength < FAH_JSON_FILTER_MAX_KEY)
+				Key[KeyLength++] = c;
+			else
+				KeyTooLong = true;
+			return;
+
+		case FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_COLON:
+			if (isJsonSpace(c))
+				return;
+			if (c != ':')
+			{
+				State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_ERROR;
+				return;
+			}
+			SelectPaths();
+			State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_VALUE;
+			return;
+
+		case FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_NEXT_OR_END:
+			if (isJsonSpace(c))
+				return;
+			if (c == ',')
+				State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_KEY_OR_END;
+			else if (c == '}')
+				EndObject();
+			else
+				State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_ERROR;
+			return;
+
+		case FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_RAW:
+			ProcessRaw(c);
+			return;
+
+		case FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_DONE:
+			if (!isJsonSpace(c))
+				State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_ERROR;
+			return;
+
+		default:
+			return;
+	}
+}
+
+void FahJsonFilter::ProcessRaw(const char& c)
+{
+	if (RawString)
+	{
+		if (RawKeep)
+			Emit(c);
+		if (RawEscape)
+			RawEscape = false;
+		else if (c == '\\')
+			RawEscape = true;
+		else if (c == '"')
+		{
+			RawString = false;
+			if (RawDepth == 0)
+				EndValue();
+		}
+		return;
+	}
+
+	if (RawScalar)
+	{
+		if (isJsonSpace(c) || c == ',' || c == '}' || c == ']')
+		{
+			//The delimiter belongs to the enclosing object
+			EndValue();
+			Process(c);
+			return;
+		}
+		if (RawKeep)
+			Emit(c);
+		return;
+	}
+
+	if (isJsonSpace(c))
+		return;
+	if (RawKeep)
+		Emit(c);
+	if (c == '"')
+		RawString = true;
+	else if (c == '{' || c == '[')
+		RawDepth++;
+	else if ((c == '}' || c == ']') && --RawDepth == 0)
+		EndValue();
+}
+
+void FahJsonFilter::SelectPaths()
+{
+	//Value of the member that was just read, kept when a path ends at its key, descended into when paths continue
+	ValueKeep = false;
+	ValuePaths = 0;
+	for (uint8_t i = 0; i < PathCount; i++)
+	{
+		bool last = false;
+		if ((Levels[Depth - 1].Paths & (1 << i)) && MatchKey(i, Depth - 1, last))
+		{
+			if (last)
+				ValueKeep = true;
+			else
+				ValuePaths |= (1 << i);
+		}
+	}
+}
+
+void FahJsonFilter::StartValue(const char& c)
+{
+	if (ValueKeep)
+	{
+		EmitMemberKey();
+		StartRaw(c, true);
+	}
+	else if (c == '{' && ValuePaths != 0)
+	{
+		if (Depth >= FAH_JSON_FILTER_MAX_DEPTH)
+		{
+			State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_ERROR;
+			return;
+		}
+		if (Depth > 0)
+			EmitMemberKey();
+		Emit('{');
+		Levels[Depth].Paths = ValuePaths;
+		Levels[Depth].Empty = true;
+		Depth++;
+		State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_KEY_OR_END;
+	}
+	else
+	{
+		StartRaw(c, false);
+	}
+}
+
+void FahJsonFilter::StartRaw(const char& c, const bool& Keep)
+{
+	if (c == '}' || c == ']' || c == ',' || c == ':')
+	{
+		State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_ERROR;
+		return;
+	}
+	RawKeep = Keep;
+	RawString = (c == '"');
+	RawEscape = false;
+	RawDepth = (c == '{' || c == '[') ? 1 : 0;
+	RawScalar = !RawString && RawDepth == 0;
+	State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_RAW;
+	if (RawKeep)
+		Emit(c);
+}
+
+void FahJsonFilter::EndObject()
+{
+	Emit('}');
+	Depth--;
+	EndValue();
+}
+
+void FahJsonFilter::EndValue()
+{
+	if (Depth == 0)
+		State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_DONE;
+	else
+		State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_NEXT_OR_END;
+}
+
+bool FahJsonFilter::MatchKey(const uint8_t& PathIndex, const uint8_t& Segment, bool& Last)
+{
+	//A truncated key cannot be written back, not even for a wildcard
+	if (KeyTooLong)
+		return false;
+
+	const char* segment = Paths[PathIndex].c_str();
+	for (uint8_t i = 0; i < Segment; i++)
+	{
+		segment = strchr(segment, '/');
+		if (segment == NULL)
+			return false;
+		segment++;
+	}
+	const char* end = strchr(segment, '/');
+	size_t length = (end == NULL) ? strlen(segment) : (size_t)(end - segment);
+	Last = (end == NULL);
+	if (length == 1 && *segment == '*')
+		return true;
+	return length == KeyLength && strncmp(segment, Key, length) == 0;
+}
+
+void FahJsonFilter::EmitMemberKey()
+{
+	Level& level = Levels[Depth - 1];
+	if (!level.Empty)
+		Emit(',');
+	level.Empty = false;
+	Emit('"');
+	for (uint8_t i = 0; i < KeyLength; i++)
+		Emit(Key[i]);
+	Emit('"');
+	Emit(':');
+}
+
+void FahJsonFilter::Emit(const char& c)
+{
+	if (Output.length() >= MaxOutputSize)
+	{
+		OutputFull = true;
+		return;
+	}
+	Output.concat(c);
+	OutputHash = FahHashByte(OutputHash, (uint8_t)c);
+}
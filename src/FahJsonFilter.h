@@ -0,0 +1,85 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include <Arduino.h>
+#include "HTTPClient.h"
+#include "FahHash.h"
+
+#define FAH_JSON_FILTER_MAX_PATHS 4
+#define FAH_JSON_FILTER_MAX_DEPTH 8 //Objects along a path, values that are kept as a whole may nest deeper
+#define FAH_JSON_FILTER_MAX_KEY 40 //Longer keys never match a path
+
+namespace FAH_JSON_FILTER_STATES
+{
+	enum FAH_JSON_FILTER_STATE : uint8_t
+	{
+		FAH_JSON_FILTER_VALUE = 0,
+		FAH_JSON_FILTER_KEY_OR_END = 1,
+		FAH_JSON_FILTER_KEY = 2,
+		FAH_JSON_FILTER_COLON = 3,
+		FAH_JSON_FILTER_NEXT_OR_END = 4,
+		FAH_JSON_FILTER_RAW = 5, //Value that is copied or skipped as a whole
+		FAH_JSON_FILTER_DONE = 6,
+		FAH_JSON_FILTER_ERROR = 7,
+	};
+}
+typedef FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_STATE FAH_JSON_FILTER_STATE;
+
+//Keeps the values at the added paths of a JSON document that arrives in pieces, the state is kept between writes.
+//The output has the same nesting as the document, it is bound by what the paths select and not by the document size.
+class FahJsonFilter : public HTTPBodySink
+{
+public:
+	FahJsonFilter(const uint16_t& MaxOutputSize);
+	bool AddPath(const String& Path); //Keys separated by '/', "*" matches any key; add all paths before the first Write
+	bool Write(const uint8_t* Data, const size_t& Length);
+	bool isComplete() { return State == FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_DONE && !OutputFull; };
+	const String& GetOutput() { return Output; };
+	uint32_t GetOutputHash() { return OutputHash; };
+private:
+	struct Level
+	{
+		uint8_t Paths; //Bit per path that continues below this object
+		bool Empty;
+	};
+	void Process(const char& c);
+	void ProcessRaw(const char& c);
+	void SelectPaths();
+	void StartValue(const char& c);
+	void StartRaw(const char& c, const bool& Keep);
+	void EndObject();
+	void EndValue();
+	bool MatchKey(const uint8_t& PathIndex, const uint8_t& Segment, bool& Last);
+	void EmitMemberKey();
+	void Emit(const char& c);
+	String Paths[FAH_JSON_FILTER_MAX_PATHS];
+	uint8_t PathCount = 0;
+	Level Levels[FAH_JSON_FILTER_MAX_DEPTH];
+	uint8_t Depth = 0;
+	char Key[FAH_JSON_FILTER_MAX_KEY];
+	uint8_t KeyLength = 0;
+	bool KeyTooLong = false;
+	bool KeyEscape = false;
+	bool ValueKeep = false;
+	uint8_t ValuePaths = 0;
+	bool RawKeep = false;
+	bool RawString = false;
+	bool RawEscape = false;
+	bool RawScalar = false;
+	uint16_t RawDepth = 0;
+	String Output = "";
+	uint16_t MaxOutputSize;
+	bool OutputFull = false;
+	uint32_t OutputHash = FAH_HASH_INIT;
+	FAH_JSON_FILTER_STATE State = FAH_JSON_FILTER_STATES::FAH_JSON_FILTER_VALUE;
+};
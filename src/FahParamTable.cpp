@@ -0,0 +1,692 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahParamTable.h"
+
+//Generated from FahParamDefinitions.h, the value type is derived from the parameter name
+//and corrected by hand where the name misleads, like the eco setpoints named ..._ECO_MODE
+//Entries are sorted by ID for the binary search in FahParamTable::Find
+
+static const char PNAME_LED_DAY_BRIGHTNESS[] PROGMEM = "LED_DAY_BRIGHTNESS";
+static const char PNAME_LED_NIGHT_BRIGHTNESS[] PROGMEM = "LED_NIGHT_BRIGHTNESS";
+static const char PNAME_DIMMING_ACTUATOR_TYPE1_LOAD_TYPE[] PROGMEM = "DIMMING_ACTUATOR_TYPE1_LOAD_TYPE";
+static const char PNAME_DIMMING_ACTUATOR_MIN_BRIGHTNESS[] PROGMEM = "DIMMING_ACTUATOR_MIN_BRIGHTNESS";
+static const char PNAME_DIMMING_ACTUATOR_MAX_BRIGHTNESS_DAY[] PROGMEM = "DIMMING_ACTUATOR_MAX_BRIGHTNESS_DAY";
+static const char PNAME_SENSOR_FORCE_ON_OFF[] PROGMEM = "SENSOR_FORCE_ON_OFF";
+static const char PNAME_LED_OPERATION_MODE[] PROGMEM = "LED_OPERATION_MODE";
+static const char PNAME_TOTAL_BLINDS_MOVEMENT_TIME[] PROGMEM = "TOTAL_BLINDS_MOVEMENT_TIME";
+static const char PNAME_TOTAL_BLINDS_MOVEMENT_TIME_CALIBRATED[] PROGMEM = "TOTAL_BLINDS_MOVEMENT_TIME_CALIBRATED";
+static const char PNAME_TOTAL_SLATS_MOVEMENT_TIME[] PROGMEM = "TOTAL_SLATS_MOVEMENT_TIME";
+static const char PNAME_TOTAL_SLATS_MOVEMENT_TIME_CALIBRATED[] PROGMEM = "TOTAL_SLATS_MOVEMENT_TIME_CALIBRATED";
+static const char PNAME_CHANNEL_SELECTOR_2_GANG[] PROGMEM = "CHANNEL_SELECTOR_2_GANG";
+static const char PNAME_SENSOR_FORCE_UP_DOWN[] PROGMEM = "SENSOR_FORCE_UP_DOWN";
+static const char PNAME_CHANNEL_SELECTOR_BINARY_INPUT_2_GANG[] PROGMEM = "CHANNEL_SELECTOR_BINARY_INPUT_2_GANG";
+static const char PNAME_CHANNEL_SELECTOR_BINARY_INPUT_4_GANG[] PROGMEM = "CHANNEL_SELECTOR_BINARY_INPUT_4_GANG";
+static const char PNAME_BI_CONTACT_TYPE[] PROGMEM = "BI_CONTACT_TYPE";
+static const char PNAME_BI_FORCE_ON_OFF[] PROGMEM = "BI_FORCE_ON_OFF";
+static const char PNAME_DIMMING_ACTUATOR_MAX_BRIGHTNESS_NIGHT[] PROGMEM = "DIMMING_ACTUATOR_MAX_BRIGHTNESS_NIGHT";
+static const char PNAME_DIMMING_ACTUATOR_TYPE0_LOAD_TYPE[] PROGMEM = "DIMMING_ACTUATOR_TYPE0_LOAD_TYPE";
+static const char PNAME_BEHAVIOUR_ON_MALFUNCTION[] PROGMEM = "BEHAVIOUR_ON_MALFUNCTION";
+static const char PNAME_AUTONOMOUS_SWITCH_OFF_TIME_DURATION[] PROGMEM = "AUTONOMOUS_SWITCH_OFF_TIME_DURATION";
+static const char PNAME_DEFAULT_SETPOINT_TEMPERATURE[] PROGMEM = "DEFAULT_SETPOINT_TEMPERATURE";
+static const char PNAME_ECO_DELTA_TEMPERATURE[] PROGMEM = "ECO_DELTA_TEMPERATURE";
+static const char PNAME_PRESENCE_DETECTOR_TIMED_ON_DURATION[] PROGMEM = "PRESENCE_DETECTOR_TIMED_ON_DURATION";
+static const char PNAME_TEMPERATURE_CORRECTION[] PROGMEM = "TEMPERATURE_CORRECTION";
+static const char PNAME_TEMPERATURE_SEND_INTERVAL[] PROGMEM = "TEMPERATURE_SEND_INTERVAL";
+static const char PNAME_MAX_TEMP_ADJ[] PROGMEM = "MAX_TEMP_ADJ";
+static const char PNAME_MIN_TEMP_ADJ[] PROGMEM = "MIN_TEMP_ADJ";
+static const char PNAME_RTC_HAS_FANCOIL[] PROGMEM = "RTC_HAS_FANCOIL";
+static const char PNAME_DISPLAY_SWITCH_OFF_TIME[] PROGMEM = "DISPLAY_SWITCH_OFF_TIME";
+static const char PNAME_FAIR_MODE[] PROGMEM = "FAIR_MODE";
+static const char PNAME_SCENE_MODE[] PROGMEM = "SCENE_MODE";
+static const char PNAME_SWITCH_ON_MODE_RGB[] PROGMEM = "SWITCH_ON_MODE_RGB";
+static const char PNAME_CHANNEL_SELECTOR_8_GANG[] PROGMEM = "CHANNEL_SELECTOR_8_GANG";
+static const char PNAME_SWITCH_ACTUATOR_BEHAVIOR_ON_MALFUNCTION[] PROGMEM = "SWITCH_ACTUATOR_BEHAVIOR_ON_MALFUNCTION";
+static const char PNAME_DELAY_TIME[] PROGMEM = "DELAY_TIME";
+static const char PNAME_DIMMER_SWITCH_ON_MODE[] PROGMEM = "DIMMER_SWITCH_ON_MODE";
+static const char PNAME_TEMPERATURE_SOURCE[] PROGMEM = "TEMPERATURE_SOURCE";
+static const char PNAME_BRIGHTNESS_ALERT_ACTIVATION_LEVEL[] PROGMEM = "BRIGHTNESS_ALERT_ACTIVATION_LEVEL";
+static const char PNAME_HYSTERESIS[] PROGMEM = "HYSTERESIS";
+static const char PNAME_FROST_ALARM_ACTIVATION_LEVEL[] PROGMEM = "FROST_ALARM_ACTIVATION_LEVEL";
+static const char PNAME_WIND_FORCE[] PROGMEM = "WIND_FORCE";
+static const char PNAME_CONTACT_TYPE[] PROGMEM = "CONTACT_TYPE";
+static const char PNAME_BEHAVIOUR_ON_MALFUNCTION_HEATING[] PROGMEM = "BEHAVIOUR_ON_MALFUNCTION_HEATING";
+static const char PNAME_PWM_PERIOD[] PROGMEM = "PWM_PERIOD";
+static const char PNAME_TRIGGER_DURATION[] PROGMEM = "TRIGGER_DURATION";
+static const char PNAME_MOVEMENT_DETECTOR_SWITCH_ON_CONDITIONS[] PROGMEM = "MOVEMENT_DETECTOR_SWITCH_ON_CONDITIONS";
+static const char PNAME_TOTAL_BLINDS_MOVEMENT_TIME_DOWN[] PROGMEM = "TOTAL_BLINDS_MOVEMENT_TIME_DOWN";
+static const char PNAME_TOTAL_BLINDS_MOVEMENT_TIME_CALIBRATED_DOWN[] PROGMEM = "TOTAL_BLINDS_MOVEMENT_TIME_CALIBRATED_DOWN";
+static const char PNAME_ENGINE_SWITCH_ON_DELAY_TIME[] PROGMEM = "ENGINE_SWITCH_ON_DELAY_TIME";
+static const char PNAME_DEVICE_CHANNEL_SELECTOR[] PROGMEM = "DEVICE_CHANNEL_SELECTOR";
+static const char PNAME_TRANSMISSION_INTERVAL[] PROGMEM = "TRANSMISSION_INTERVAL";
+static const char PNAME_FAN_COIL_FAN_SPEED[] PROGMEM = "FAN_COIL_FAN_SPEED";
+static const char PNAME_FAN_COIL_NIGHT_MODE[] PROGMEM = "FAN_COIL_NIGHT_MODE";
+static const char PNAME_FAN_COIL_FAN_MODE[] PROGMEM = "FAN_COIL_FAN_MODE";
+static const char PNAME_FAN_COIL_FAN_STARTUP_TIME[] PROGMEM = "FAN_COIL_FAN_STARTUP_TIME";
+static const char PNAME_FAN_COIL_FAN_CHANGEOVER_DELAY[] PROGMEM = "FAN_COIL_FAN_CHANGEOVER_DELAY";
+static const char PNAME_CONTACT_TYPE_A[] PROGMEM = "CONTACT_TYPE_A";
+static const char PNAME_CONTACT_TYPE_B[] PROGMEM = "CONTACT_TYPE_B";
+static const char PNAME_FAN_COIL_VALVE_OPENING_TIME[] PROGMEM = "FAN_COIL_VALVE_OPENING_TIME";
+static const char PNAME_FAN_COIL_PWM_PROFILE[] PROGMEM = "FAN_COIL_PWM_PROFILE";
+static const char PNAME_SENSOR_TYPE[] PROGMEM = "SENSOR_TYPE";
+static const char PNAME_FAN_COIL_VALVE_3POINT[] PROGMEM = "FAN_COIL_VALVE_3POINT";
+static const char PNAME_FAN_COIL_VALVE_NCNO[] PROGMEM = "FAN_COIL_VALVE_NCNO";
+static const char PNAME_PRIMARY_FUNCTION[] PROGMEM = "PRIMARY_FUNCTION";
+static const char PNAME_ALERT_ACTIVATION_DELAY[] PROGMEM = "ALERT_ACTIVATION_DELAY";
+static const char PNAME_DEALERT_ACTIVATION_DELAY[] PROGMEM = "DEALERT_ACTIVATION_DELAY";
+static const char PNAME_RAIN_SENSOR_SENSITIVITY[] PROGMEM = "RAIN_SENSOR_SENSITIVITY";
+static const char PNAME_HOURS_PER_DAY[] PROGMEM = "HOURS_PER_DAY";
+static const char PNAME_USER_LANGUAGE[] PROGMEM = "USER_LANGUAGE";
+static const char PNAME_EFFECTIVE_USER_LANGUAGE[] PROGMEM = "EFFECTIVE_USER_LANGUAGE";
+static const char PNAME_TEMP_SENSOR_USAGE[] PROGMEM = "TEMP_SENSOR_USAGE";
+static const char PNAME_EXT_TEMP_OFFSET[] PROGMEM = "EXT_TEMP_OFFSET";
+static const char PNAME_TEMP_LIMIT[] PROGMEM = "TEMP_LIMIT";
+static const char PNAME_ACOUSTIC_FEEDBACK[] PROGMEM = "ACOUSTIC_FEEDBACK";
+static const char PNAME_REFERENCE_DRIVE_BEFORE_POSITIONING[] PROGMEM = "REFERENCE_DRIVE_BEFORE_POSITIONING";
+static const char PNAME_PROVIDE_TEMPERATURE[] PROGMEM = "PROVIDE_TEMPERATURE";
+static const char PNAME_HC_ACTIVE_THRESHOLD[] PROGMEM = "HC_ACTIVE_THRESHOLD";
+static const char PNAME_POWER_SAVING_MODE[] PROGMEM = "POWER_SAVING_MODE";
+static const char PNAME_HANDLE_WIND_ALARM[] PROGMEM = "HANDLE_WIND_ALARM";
+static const char PNAME_HANDLE_RAIN_ALARM[] PROGMEM = "HANDLE_RAIN_ALARM";
+static const char PNAME_HANDLE_FROST_ALARM[] PROGMEM = "HANDLE_FROST_ALARM";
+static const char PNAME_HANDLE_WINDOW_ALARM[] PROGMEM = "HANDLE_WINDOW_ALARM";
+static const char PNAME_BEHAVIOUR_DISABLE_FORCE[] PROGMEM = "BEHAVIOUR_DISABLE_FORCE";
+static const char PNAME_SONOS_GROUP_BIT_POSITION[] PROGMEM = "SONOS_GROUP_BIT_POSITION";
+static const char PNAME_SONOS_SENSOR_BEHAVIOUR[] PROGMEM = "SONOS_SENSOR_BEHAVIOUR";
+static const char PNAME_SONOS_PLAYER_VOLUME_LIMIT[] PROGMEM = "SONOS_PLAYER_VOLUME_LIMIT";
+static const char PNAME_CEILING_FAN_SWITCH_ON_MODE[] PROGMEM = "CEILING_FAN_SWITCH_ON_MODE";
+static const char PNAME_CFAT0_MINIMUM_FAN_SPEED[] PROGMEM = "CFAT0_MINIMUM_FAN_SPEED";
+static const char PNAME_CFAT0_MAXIMUM_FAN_SPEED[] PROGMEM = "CFAT0_MAXIMUM_FAN_SPEED";
+static const char PNAME_TEMPERATURE_UNIT[] PROGMEM = "TEMPERATURE_UNIT";
+static const char PNAME_EFFECTIVE_TEMPERATURE_UNIT[] PROGMEM = "EFFECTIVE_TEMPERATURE_UNIT";
+static const char PNAME_AWAKE_INDICATOR[] PROGMEM = "AWAKE_INDICATOR";
+static const char PNAME_HEATING_FIRST_STAGE[] PROGMEM = "HEATING_FIRST_STAGE";
+static const char PNAME_HEATING_SECOND_STAGE[] PROGMEM = "HEATING_SECOND_STAGE";
+static const char PNAME_COOLING_FIRST_STAGE[] PROGMEM = "COOLING_FIRST_STAGE";
+static const char PNAME_COOLING_SECOND_STAGE[] PROGMEM = "COOLING_SECOND_STAGE";
+static const char PNAME_REVERSING_VALVE_OPMODE[] PROGMEM = "REVERSING_VALVE_OPMODE";
+static const char PNAME_AUX_TYPE[] PROGMEM = "AUX_TYPE";
+static const char PNAME_COMPRESSOR_DELAY[] PROGMEM = "COMPRESSOR_DELAY";
+static const char PNAME_TEMPERATURE_EXTRACT_HEAT[] PROGMEM = "TEMPERATURE_EXTRACT_HEAT";
+static const char PNAME_TEMPERATURE_EXTRACT_COOL[] PROGMEM = "TEMPERATURE_EXTRACT_COOL";
+static const char PNAME_VALUES_IN_ACTIVE_MODE[] PROGMEM = "VALUES_IN_ACTIVE_MODE";
+static const char PNAME_SHOW_TEMPERATURE_WHILE_OFF[] PROGMEM = "SHOW_TEMPERATURE_WHILE_OFF";
+static const char PNAME_SHORTCUT_FOR_FAN[] PROGMEM = "SHORTCUT_FOR_FAN";
+static const char PNAME_SHORTCUT_FOR_HEAT[] PROGMEM = "SHORTCUT_FOR_HEAT";
+static const char PNAME_SHORTCUT_FOR_COOL[] PROGMEM = "SHORTCUT_FOR_COOL";
+static const char PNAME_SHORTCUT_FOR_AUX[] PROGMEM = "SHORTCUT_FOR_AUX";
+static const char PNAME_SHORTCUT_FOR_ECO[] PROGMEM = "SHORTCUT_FOR_ECO";
+static const char PNAME_SHORTCUT_FOR_OFF[] PROGMEM = "SHORTCUT_FOR_OFF";
+static const char PNAME_FAN_MANUAL_RUNTIME[] PROGMEM = "FAN_MANUAL_RUNTIME";
+static const char PNAME_DELAY_FOR_EXIT_MODE[] PROGMEM = "DELAY_FOR_EXIT_MODE";
+static const char PNAME_PROTECTION_HIGH_LIMIT[] PROGMEM = "PROTECTION_HIGH_LIMIT";
+static const char PNAME_PROTECTION_LOW_LIMIT[] PROGMEM = "PROTECTION_LOW_LIMIT";
+static const char PNAME_MINIMUM_ON_TIME[] PROGMEM = "MINIMUM_ON_TIME";
+static const char PNAME_FAN_ON_TIME_LAG[] PROGMEM = "FAN_ON_TIME_LAG";
+static const char PNAME_FAN_OFF_TIME_LAG[] PROGMEM = "FAN_OFF_TIME_LAG";
+static const char PNAME_COMPRESSOR_LOCKOUT[] PROGMEM = "COMPRESSOR_LOCKOUT";
+static const char PNAME_HEAT_PUMP_AUX_HEAT_LOCKOUT[] PROGMEM = "HEAT_PUMP_AUX_HEAT_LOCKOUT";
+static const char PNAME_FIRST_STAGE_COMP_CYCLE_RATE[] PROGMEM = "FIRST_STAGE_COMP_CYCLE_RATE";
+static const char PNAME_SECOND_STAGE_COMP_CYCLE_RATE[] PROGMEM = "SECOND_STAGE_COMP_CYCLE_RATE";
+static const char PNAME_FIRST_STAGE_HEAT_CYCLE_RATE[] PROGMEM = "FIRST_STAGE_HEAT_CYCLE_RATE";
+static const char PNAME_SECOND_STAGE_HEAT_CYCLE_RATE[] PROGMEM = "SECOND_STAGE_HEAT_CYCLE_RATE";
+static const char PNAME_EMERGENCY_HEAT_CYCLE_RATE[] PROGMEM = "EMERGENCY_HEAT_CYCLE_RATE";
+static const char PNAME_FAN_CONTROL[] PROGMEM = "FAN_CONTROL";
+static const char PNAME_HEAT_PUMP_TIME[] PROGMEM = "HEAT_PUMP_TIME";
+static const char PNAME_HIGH_COOL_LATCH[] PROGMEM = "HIGH_COOL_LATCH";
+static const char PNAME_HIGH_HEAT_LATCH[] PROGMEM = "HIGH_HEAT_LATCH";
+static const char PNAME_COOLING_HYSTERESIS[] PROGMEM = "COOLING_HYSTERESIS";
+static const char PNAME_HEATING_HYSTERESIS[] PROGMEM = "HEATING_HYSTERESIS";
+static const char PNAME_HC_SWITCH_DELAY[] PROGMEM = "HC_SWITCH_DELAY";
+static const char PNAME_MAXIMUM_SETPOINT_TEMPERATURE[] PROGMEM = "MAXIMUM_SETPOINT_TEMPERATURE";
+static const char PNAME_MINIMUM_SETPOINT_TEMPERATURE[] PROGMEM = "MINIMUM_SETPOINT_TEMPERATURE";
+static const char PNAME_STAGING_TIMER_OVERRIDE[] PROGMEM = "STAGING_TIMER_OVERRIDE";
+static const char PNAME_ARMING_OPTION[] PROGMEM = "ARMING_OPTION";
+static const char PNAME_DAY_OF_WEEK[] PROGMEM = "DAY_OF_WEEK";
+static const char PNAME_START_TIME[] PROGMEM = "START_TIME";
+static const char PNAME_END_TIME[] PROGMEM = "END_TIME";
+static const char PNAME_ARM_DELAY[] PROGMEM = "ARM_DELAY";
+static const char PNAME_SILENT_MODE[] PROGMEM = "SILENT_MODE";
+static const char PNAME_PAIRING_PARTNER_PRODUCTION_NUMBER[] PROGMEM = "PAIRING_PARTNER_PRODUCTION_NUMBER";
+static const char PNAME_PAIRING_PARTNER_MANUFACTURER[] PROGMEM = "PAIRING_PARTNER_MANUFACTURER";
+static const char PNAME_SWITCH_OFF_DELAY_MIN[] PROGMEM = "SWITCH_OFF_DELAY_MIN";
+static const char PNAME_TWO_LEVEL_CONTROLLER_HYSTERESIS[] PROGMEM = "TWO_LEVEL_CONTROLLER_HYSTERESIS";
+static const char PNAME_LED_BRIGHTNESS[] PROGMEM = "LED_BRIGHTNESS";
+static const char PNAME_LED_OFF_AT_NIGHT[] PROGMEM = "LED_OFF_AT_NIGHT";
+static const char PNAME_USER_MODE[] PROGMEM = "USER_MODE";
+static const char PNAME_INTERNAL_SIREN[] PROGMEM = "INTERNAL_SIREN";
+static const char PNAME_WIZARD_COMPLETED[] PROGMEM = "WIZARD_COMPLETED";
+static const char PNAME_TWILIGHT_BRIGHTNESS[] PROGMEM = "TWILIGHT_BRIGHTNESS";
+static const char PNAME_WIRING[] PROGMEM = "WIRING";
+static const char PNAME_WIND_SPEED_UNIT[] PROGMEM = "WIND_SPEED_UNIT";
+static const char PNAME_EFFECTIVE_WIND_SPEED_UNIT[] PROGMEM = "EFFECTIVE_WIND_SPEED_UNIT";
+static const char PNAME_FAN_LEVEL_STEP_WIDTH[] PROGMEM = "FAN_LEVEL_STEP_WIDTH";
+static const char PNAME_DIMMING_ACTUATOR_TYPE2_LOAD_TYPE[] PROGMEM = "DIMMING_ACTUATOR_TYPE2_LOAD_TYPE";
+static const char PNAME_RESET_MANUAL_FAN_STAGE[] PROGMEM = "RESET_MANUAL_FAN_STAGE";
+static const char PNAME_USE_MASTER_MEASURED_TEMPERATURE[] PROGMEM = "USE_MASTER_MEASURED_TEMPERATURE";
+static const char PNAME_LIMIT_TEMPERATURE[] PROGMEM = "LIMIT_TEMPERATURE";
+static const char PNAME_SEND_IR_TELEGRAM[] PROGMEM = "SEND_IR_TELEGRAM";
+static const char PNAME_LOCK_ON_SITE_OPERATION[] PROGMEM = "LOCK_ON_SITE_OPERATION";
+static const char PNAME_USE_TEMPLATE[] PROGMEM = "USE_TEMPLATE";
+static const char PNAME_OPENER_CONTACT[] PROGMEM = "OPENER_CONTACT";
+static const char PNAME_OUTPUT_EXECUTES_CENTRAL_INPUT[] PROGMEM = "OUTPUT_EXECUTES_CENTRAL_INPUT";
+static const char PNAME_POWER_ON_LEVEL[] PROGMEM = "POWER_ON_LEVEL";
+static const char PNAME_SYSTEM_FAILURE_LEVEL[] PROGMEM = "SYSTEM_FAILURE_LEVEL";
+static const char PNAME_CHANNEL_SELECTOR_AUX_INPUT_SHUTTER[] PROGMEM = "CHANNEL_SELECTOR_AUX_INPUT_SHUTTER";
+static const char PNAME_CHANNEL_SELECTOR_AUX_INPUT_SWITCH[] PROGMEM = "CHANNEL_SELECTOR_AUX_INPUT_SWITCH";
+static const char PNAME_CHANNEL_SELECTOR_1_GANG[] PROGMEM = "CHANNEL_SELECTOR_1_GANG";
+static const char PNAME_CHANNEL_SELECTOR_3_GANG[] PROGMEM = "CHANNEL_SELECTOR_3_GANG";
+static const char PNAME_VOLUME_SETUP[] PROGMEM = "VOLUME_SETUP";
+static const char PNAME_AUTO_RELOCK_TIME[] PROGMEM = "AUTO_RELOCK_TIME";
+static const char PNAME_ALBUM_COVER_URL[] PROGMEM = "ALBUM_COVER_URL";
+static const char PNAME_ZSTICK_CONTROL[] PROGMEM = "ZSTICK_CONTROL";
+static const char PNAME_TEMPERATURE_COLOR_PHYSICAL_COOLEST[] PROGMEM = "TEMPERATURE_COLOR_PHYSICAL_COOLEST";
+static const char PNAME_TEMPERATURE_COLOR_PHYSICAL_WARMEST[] PROGMEM = "TEMPERATURE_COLOR_PHYSICAL_WARMEST";
+static const char PNAME_DOMUS_SCENE_DISARMING[] PROGMEM = "DOMUS_SCENE_DISARMING";
+static const char PNAME_DOMUS_DISABLE_INTERNAL_BUZZER[] PROGMEM = "DOMUS_DISABLE_INTERNAL_BUZZER";
+static const char PNAME_DOMUS_ALARM_ON_BURGLARY[] PROGMEM = "DOMUS_ALARM_ON_BURGLARY";
+static const char PNAME_OPERATION_MODE[] PROGMEM = "OPERATION_MODE";
+static const char PNAME_DETECTION_AREA[] PROGMEM = "DETECTION_AREA";
+static const char PNAME_MOVEMENT_DETECTOR_TEST_MODE[] PROGMEM = "MOVEMENT_DETECTOR_TEST_MODE";
+static const char PNAME_BLIND_SENSOR_OPERATION_MODE[] PROGMEM = "BLIND_SENSOR_OPERATION_MODE";
+static const char PNAME_SWITCH_OFF_PREWARNING[] PROGMEM = "SWITCH_OFF_PREWARNING";
+static const char PNAME_HEATING_ACTUATOR_PAUSE_TIME[] PROGMEM = "HEATING_ACTUATOR_PAUSE_TIME";
+static const char PNAME_ACOUSTIC_FEEDBACK_VOLUME[] PROGMEM = "ACOUSTIC_FEEDBACK_VOLUME";
+static const char PNAME_COLOR_THEME[] PROGMEM = "COLOR_THEME";
+static const char PNAME_BRIGHTNESS_FOR_SWITCHING_TO_DARK_MODE[] PROGMEM = "BRIGHTNESS_FOR_SWITCHING_TO_DARK_MODE";
+static const char PNAME_AUTOMATIC_RETURN_TO_START_PAGE[] PROGMEM = "AUTOMATIC_RETURN_TO_START_PAGE";
+static const char PNAME_BRIGHTNESS_ADJUSTED_TO_AMBIENT_LIGHT[] PROGMEM = "BRIGHTNESS_ADJUSTED_TO_AMBIENT_LIGHT";
+static const char PNAME_SWITCH_DISPLAY_OFF_WHEN_ROOM_IS_DARK[] PROGMEM = "SWITCH_DISPLAY_OFF_WHEN_ROOM_IS_DARK";
+static const char PNAME_BRIGHTNESS_LEVEL_FOR_SWITCHING_TO_DARK[] PROGMEM = "BRIGHTNESS_LEVEL_FOR_SWITCHING_TO_DARK";
+static const char PNAME_SWITCH_OFF_TIME_AFTER_DARK[] PROGMEM = "SWITCH_OFF_TIME_AFTER_DARK";
+static const char PNAME_USE_PROXIMITY_SENSOR[] PROGMEM = "USE_PROXIMITY_SENSOR";
+static const char PNAME_PROXIMITY_SENSOR_SENSITIVITY[] PROGMEM = "PROXIMITY_SENSOR_SENSITIVITY";
+static const char PNAME_HAPTIC_FEEDBACK[] PROGMEM = "HAPTIC_FEEDBACK";
+static const char PNAME_SCEEN_SAVER[] PROGMEM = "SCEEN_SAVER";
+static const char PNAME_SCEEN_SAVER_MODE[] PROGMEM = "SCEEN_SAVER_MODE";
+static const char PNAME_AUTOMATIC_RETURN[] PROGMEM = "AUTOMATIC_RETURN";
+static const char PNAME_CHANNEL_SELECTOR_MOVEMENT_DETECTOR[] PROGMEM = "CHANNEL_SELECTOR_MOVEMENT_DETECTOR";
+static const char PNAME_CHANNEL_SELECTOR_AUX_INPUT_SWITCH_1_GANG[] PROGMEM = "CHANNEL_SELECTOR_AUX_INPUT_SWITCH_1_GANG";
+static const char PNAME_CHANNEL_SELECTOR_CONNECTED_VALVES[] PROGMEM = "CHANNEL_SELECTOR_CONNECTED_VALVES";
+static const char PNAME_CHANNEL_SELECTOR_CHANNEL_1[] PROGMEM = "CHANNEL_SELECTOR_CHANNEL_1";
+static const char PNAME_CHANNEL_SELECTOR_CHANNEL_2[] PROGMEM = "CHANNEL_SELECTOR_CHANNEL_2";
+static const char PNAME_CHANNEL_SELECTOR_CHANNEL_3[] PROGMEM = "CHANNEL_SELECTOR_CHANNEL_3";
+static const char PNAME_CHANNEL_SELECTOR_CHANNEL_4[] PROGMEM = "CHANNEL_SELECTOR_CHANNEL_4";
+static const char PNAME_CHANNEL_SELECTOR_CHANNEL_5[] PROGMEM = "CHANNEL_SELECTOR_CHANNEL_5";
+static const char PNAME_CHANNEL_SELECTOR_CHANNEL_6[] PROGMEM = "CHANNEL_SELECTOR_CHANNEL_6";
+static const char PNAME_DOMUS_USER_INSTALLER[] PROGMEM = "DOMUS_USER_INSTALLER";
+static const char PNAME_DOMUS_USER_0[] PROGMEM = "DOMUS_USER_0";
+static const char PNAME_DOMUS_USER_1[] PROGMEM = "DOMUS_USER_1";
+static const char PNAME_DOMUS_USER_2[] PROGMEM = "DOMUS_USER_2";
+static const char PNAME_DOMUS_USER_3[] PROGMEM = "DOMUS_USER_3";
+static const char PNAME_DOMUS_USER_4[] PROGMEM = "DOMUS_USER_4";
+static const char PNAME_DOMUS_USER_5[] PROGMEM = "DOMUS_USER_5";
+static const char PNAME_DOMUS_USER_6[] PROGMEM = "DOMUS_USER_6";
+static const char PNAME_DOMUS_USER_7[] PROGMEM = "DOMUS_USER_7";
+static const char PNAME_DOMUS_USER_8[] PROGMEM = "DOMUS_USER_8";
+static const char PNAME_DOMUS_KEY_0[] PROGMEM = "DOMUS_KEY_0";
+static const char PNAME_DOMUS_KEY_1[] PROGMEM = "DOMUS_KEY_1";
+static const char PNAME_DOMUS_KEY_2[] PROGMEM = "DOMUS_KEY_2";
+static const char PNAME_DOMUS_KEY_3[] PROGMEM = "DOMUS_KEY_3";
+static const char PNAME_DOMUS_KEY_4[] PROGMEM = "DOMUS_KEY_4";
+static const char PNAME_DOMUS_SIREN_INTRUSION_RINGTONE[] PROGMEM = "DOMUS_SIREN_INTRUSION_RINGTONE";
+static const char PNAME_DOMUS_SIREN_INTRUSION_LED[] PROGMEM = "DOMUS_SIREN_INTRUSION_LED";
+static const char PNAME_DOMUS_SIREN_SAFETY_RINGTONE[] PROGMEM = "DOMUS_SIREN_SAFETY_RINGTONE";
+static const char PNAME_DOMUS_SIREN_SAFETY_LED[] PROGMEM = "DOMUS_SIREN_SAFETY_LED";
+static const char PNAME_CHANNEL_SELECTOR_MWIRE_ROCKER_1GANG[] PROGMEM = "CHANNEL_SELECTOR_MWIRE_ROCKER_1GANG";
+static const char PNAME_CHANNEL_SELECTOR_MWIRE_ROCKER_2GANG[] PROGMEM = "CHANNEL_SELECTOR_MWIRE_ROCKER_2GANG";
+static const char PNAME_DOMUS_SELECTED_REPEATER[] PROGMEM = "DOMUS_SELECTED_REPEATER";
+static const char PNAME_CHANNEL_SELECTOR_MWIRE_MOVEMENT_DETECTOR[] PROGMEM = "CHANNEL_SELECTOR_MWIRE_MOVEMENT_DETECTOR";
+static const char PNAME_CHANNEL_SELECTOR_FUNCTION_INPUT_A[] PROGMEM = "CHANNEL_SELECTOR_FUNCTION_INPUT_A";
+static const char PNAME_CHANNEL_SELECTOR_FUNCTION_INPUT_B[] PROGMEM = "CHANNEL_SELECTOR_FUNCTION_INPUT_B";
+static const char PNAME_BI_CONTACT_TYPE_INPUT_A[] PROGMEM = "BI_CONTACT_TYPE_INPUT_A";
+static const char PNAME_BI_CONTACT_TYPE_INPUT_B[] PROGMEM = "BI_CONTACT_TYPE_INPUT_B";
+static const char PNAME_DIMMING_ACTUATOR_MAX_BRIGHTNESS[] PROGMEM = "DIMMING_ACTUATOR_MAX_BRIGHTNESS";
+static const char PNAME_HEIGHT_ABOVE_SEA[] PROGMEM = "HEIGHT_ABOVE_SEA";
+static const char PNAME_CALDION_UI_DURING_NON_USE[] PROGMEM = "CALDION_UI_DURING_NON_USE";
+static const char PNAME_IGNORE_LOCAL_TEMPERATURE[] PROGMEM = "IGNORE_LOCAL_TEMPERATURE";
+static const char PNAME_PRESENCE_DETECTOR_SWITCH_ON_CONDITION[] PROGMEM = "PRESENCE_DETECTOR_SWITCH_ON_CONDITION";
+static const char PNAME_PRESENCE_DETECTOR_SWITCH_ON_MODE[] PROGMEM = "PRESENCE_DETECTOR_SWITCH_ON_MODE";
+static const char PNAME_PRESENCE_DETECTOR_TARGET_BRIGHTNESS[] PROGMEM = "PRESENCE_DETECTOR_TARGET_BRIGHTNESS";
+static const char PNAME_BASIC_SETPOINT_HEATING_COMFORT[] PROGMEM = "BASIC_SETPOINT_HEATING_COMFORT";
+static const char PNAME_BASIC_SETPOINT_HEATING_ECO_MODE[] PROGMEM = "BASIC_SETPOINT_HEATING_ECO_MODE";
+static const char PNAME_BASIC_SETPOINT_COOLING_COMFORT[] PROGMEM = "BASIC_SETPOINT_COOLING_COMFORT";
+static const char PNAME_BASIC_SETPOINT_COOLING_ECO_MODE[] PROGMEM = "BASIC_SETPOINT_COOLING_ECO_MODE";
+static const char PNAME_TEMPERATURE_LOWER_LIMIT_FLOOR[] PROGMEM = "TEMPERATURE_LOWER_LIMIT_FLOOR";
+static const char PNAME_TEMPERATURE_UPPER_LIMIT_FLOOR[] PROGMEM = "TEMPERATURE_UPPER_LIMIT_FLOOR";
+static const char PNAME_ADAPTIVE_TIMER_CONTROL[] PROGMEM = "ADAPTIVE_TIMER_CONTROL";
+static const char PNAME_EXTERNAL_INPUT_FUNCTION[] PROGMEM = "EXTERNAL_INPUT_FUNCTION";
+static const char PNAME_CONTROLLER_TYPE[] PROGMEM = "CONTROLLER_TYPE";
+static const char PNAME_BUILDING_PROTECTION[] PROGMEM = "BUILDING_PROTECTION";
+static const char PNAME_VALVE_PROTECTION[] PROGMEM = "VALVE_PROTECTION";
+static const char PNAME_EXTERNAL_TEMPERATURE_SENSOR_TYPE[] PROGMEM = "EXTERNAL_TEMPERATURE_SENSOR_TYPE";
+static const char PNAME_SWITCH_OVER_TO_HEATING[] PROGMEM = "SWITCH_OVER_TO_HEATING";
+static const char PNAME_SWITCH_OVER_TO_COOLING[] PROGMEM = "SWITCH_OVER_TO_COOLING";
+static const char PNAME_BOOSTER_TIMER[] PROGMEM = "BOOSTER_TIMER";
+static const char PNAME_SWITCHING_CAPACITY[] PROGMEM = "SWITCHING_CAPACITY";
+static const char PNAME_PIR_1_SENSITIVITY[] PROGMEM = "PIR_1_SENSITIVITY";
+static const char PNAME_PIR_2_SENSITIVITY[] PROGMEM = "PIR_2_SENSITIVITY";
+static const char PNAME_PIR_3_SENSITIVITY[] PROGMEM = "PIR_3_SENSITIVITY";
+static const char PNAME_PIR_4_SENSITIVITY[] PROGMEM = "PIR_4_SENSITIVITY";
+static const char PNAME_PIR_1_ACTIVE[] PROGMEM = "PIR_1_ACTIVE";
+static const char PNAME_PIR_2_ACTIVE[] PROGMEM = "PIR_2_ACTIVE";
+static const char PNAME_PIR_3_ACTIVE[] PROGMEM = "PIR_3_ACTIVE";
+static const char PNAME_PIR_4_ACTIVE[] PROGMEM = "PIR_4_ACTIVE";
+static const char PNAME_SWITCH_ON_DELAY[] PROGMEM = "SWITCH_ON_DELAY";
+static const char PNAME_CHANNEL_SELECTOR_RTC_ASSIGNED_ROCKER[] PROGMEM = "CHANNEL_SELECTOR_RTC_ASSIGNED_ROCKER";
+static const char PNAME_CO2_ALERT_ACTIVATION_LEVEL[] PROGMEM = "CO2_ALERT_ACTIVATION_LEVEL";
+static const char PNAME_VOC_ALERT_ACTIVATION_LEVEL[] PROGMEM = "VOC_ALERT_ACTIVATION_LEVEL";
+static const char PNAME_DISPLAY_IDLE_TIME[] PROGMEM = "DISPLAY_IDLE_TIME";
+static const char PNAME_STD_RTC_UI_DURING_NON_USE[] PROGMEM = "STD_RTC_UI_DURING_NON_USE";
+static const char PNAME_HUMIDITY_ALERT_LOWER_LIMIT[] PROGMEM = "HUMIDITY_ALERT_LOWER_LIMIT";
+static const char PNAME_HUMIDITY_ALERT_UPPER_LIMIT[] PROGMEM = "HUMIDITY_ALERT_UPPER_LIMIT";
+static const char PNAME_ENABLE_CO2_ALERT[] PROGMEM = "ENABLE_CO2_ALERT";
+static const char PNAME_ENABLE_VOC_ALERT[] PROGMEM = "ENABLE_VOC_ALERT";
+static const char PNAME_ENABLE_HUMIDITY_ALERT[] PROGMEM = "ENABLE_HUMIDITY_ALERT";
+static const char PNAME_FEATURE_SELECTOR[] PROGMEM = "FEATURE_SELECTOR";
+static const char PNAME_REDUCED_LAYOUT[] PROGMEM = "REDUCED_LAYOUT";
+static const char PNAME_MOUNTED_IN_SOLID_WALL[] PROGMEM = "MOUNTED_IN_SOLID_WALL";
+static const char PNAME_ENGINE_SWITCH_ON_DELAY_TIME_NEW[] PROGMEM = "ENGINE_SWITCH_ON_DELAY_TIME_NEW";
+static const char PNAME_SCENE_BACKGROUND_IMG[] PROGMEM = "SCENE_BACKGROUND_IMG";
+static const char PNAME_LED_COLOR[] PROGMEM = "LED_COLOR";
+static const char PNAME_SWITCH_ROCKER_BUTTONS[] PROGMEM = "SWITCH_ROCKER_BUTTONS";
+static const char PNAME_ROCKER_ORIENTATION[] PROGMEM = "ROCKER_ORIENTATION";
+static const char PNAME_FEATURE_ORIENTATION[] PROGMEM = "FEATURE_ORIENTATION";
+static const char PNAME_FEATURE_RGB_SUPPORT[] PROGMEM = "FEATURE_RGB_SUPPORT";
+static const char PNAME_FEATURE_SWITCH_ROCKER_BUTTONS[] PROGMEM = "FEATURE_SWITCH_ROCKER_BUTTONS";
+static const char PNAME_USER_DEFINED_COLOR[] PROGMEM = "USER_DEFINED_COLOR";
+static const char PNAME_CHANNEL_SELECTOR_GENERIC_GANG[] PROGMEM = "CHANNEL_SELECTOR_GENERIC_GANG";
+static const char PNAME_SWITCH_ACTUATOR_OPERATION_MODE[] PROGMEM = "SWITCH_ACTUATOR_OPERATION_MODE";
+static const char PNAME_FORCE_MODE_DURATION_TYPE[] PROGMEM = "FORCE_MODE_DURATION_TYPE";
+static const char PNAME_FORCE_MODE_AUTONOMOUS_SWITCH_OFF_TIME_DURATION[] PROGMEM = "FORCE_MODE_AUTONOMOUS_SWITCH_OFF_TIME_DURATION";
+static const char PNAME_LOW_ENERGY_DEVICE_CHANNEL_SELECTOR[] PROGMEM = "LOW_ENERGY_DEVICE_CHANNEL_SELECTOR";
+static const char PNAME_LOW_ENERGY_DEVICE_ADDRESS[] PROGMEM = "LOW_ENERGY_DEVICE_ADDRESS";
+
+static constexpr FahParamInfo ParamInfoTable[] PROGMEM =
+{
+	{ PID_LED_DAY_BRIGHTNESS, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_LED_DAY_BRIGHTNESS },
+	{ PID_LED_NIGHT_BRIGHTNESS, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_LED_NIGHT_BRIGHTNESS },
+	{ PID_DIMMING_ACTUATOR_TYPE1_LOAD_TYPE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_DIMMING_ACTUATOR_TYPE1_LOAD_TYPE },
+	{ PID_DIMMING_ACTUATOR_MIN_BRIGHTNESS, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DIMMING_ACTUATOR_MIN_BRIGHTNESS },
+	{ PID_DIMMING_ACTUATOR_MAX_BRIGHTNESS_DAY, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DIMMING_ACTUATOR_MAX_BRIGHTNESS_DAY },
+	{ PID_SENSOR_FORCE_ON_OFF, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_SENSOR_FORCE_ON_OFF },
+	{ PID_LED_OPERATION_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_LED_OPERATION_MODE },
+	{ PID_TOTAL_BLINDS_MOVEMENT_TIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_TOTAL_BLINDS_MOVEMENT_TIME },
+	{ PID_TOTAL_BLINDS_MOVEMENT_TIME_CALIBRATED, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_TOTAL_BLINDS_MOVEMENT_TIME_CALIBRATED },
+	{ PID_TOTAL_SLATS_MOVEMENT_TIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_TOTAL_SLATS_MOVEMENT_TIME },
+	{ PID_TOTAL_SLATS_MOVEMENT_TIME_CALIBRATED, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_TOTAL_SLATS_MOVEMENT_TIME_CALIBRATED },
+	{ PID_CHANNEL_SELECTOR_2_GANG, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_2_GANG },
+	{ PID_SENSOR_FORCE_UP_DOWN, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_SENSOR_FORCE_UP_DOWN },
+	{ PID_CHANNEL_SELECTOR_BINARY_INPUT_2_GANG, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_BINARY_INPUT_2_GANG },
+	{ PID_CHANNEL_SELECTOR_BINARY_INPUT_4_GANG, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_BINARY_INPUT_4_GANG },
+	{ PID_BI_CONTACT_TYPE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_BI_CONTACT_TYPE },
+	{ PID_BI_FORCE_ON_OFF, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_BI_FORCE_ON_OFF },
+	{ PID_DIMMING_ACTUATOR_MAX_BRIGHTNESS_NIGHT, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DIMMING_ACTUATOR_MAX_BRIGHTNESS_NIGHT },
+	{ PID_DIMMING_ACTUATOR_TYPE0_LOAD_TYPE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_DIMMING_ACTUATOR_TYPE0_LOAD_TYPE },
+	{ PID_BEHAVIOUR_ON_MALFUNCTION, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_BEHAVIOUR_ON_MALFUNCTION },
+	{ PID_AUTONOMOUS_SWITCH_OFF_TIME_DURATION, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_AUTONOMOUS_SWITCH_OFF_TIME_DURATION },
+	{ PID_DEFAULT_SETPOINT_TEMPERATURE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DEFAULT_SETPOINT_TEMPERATURE },
+	{ PID_ECO_DELTA_TEMPERATURE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_ECO_DELTA_TEMPERATURE },
+	{ PID_PRESENCE_DETECTOR_TIMED_ON_DURATION, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_PRESENCE_DETECTOR_TIMED_ON_DURATION },
+	{ PID_TEMPERATURE_CORRECTION, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_TEMPERATURE_CORRECTION },
+	{ PID_TEMPERATURE_SEND_INTERVAL, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_TEMPERATURE_SEND_INTERVAL },
+	{ PID_MAX_TEMP_ADJ, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_MAX_TEMP_ADJ },
+	{ PID_MIN_TEMP_ADJ, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_MIN_TEMP_ADJ },
+	{ PID_RTC_HAS_FANCOIL, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_RTC_HAS_FANCOIL },
+	{ PID_DISPLAY_SWITCH_OFF_TIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_DISPLAY_SWITCH_OFF_TIME },
+	{ PID_FAIR_MODE, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_FAIR_MODE },
+	{ PID_SCENE_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_SCENE_MODE },
+	{ PID_SWITCH_ON_MODE_RGB, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_SWITCH_ON_MODE_RGB },
+	{ PID_CHANNEL_SELECTOR_8_GANG, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_8_GANG },
+	{ PID_SWITCH_ACTUATOR_BEHAVIOR_ON_MALFUNCTION, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_SWITCH_ACTUATOR_BEHAVIOR_ON_MALFUNCTION },
+	{ PID_DELAY_TIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_DELAY_TIME },
+	{ PID_DIMMER_SWITCH_ON_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_DIMMER_SWITCH_ON_MODE },
+	{ PID_TEMPERATURE_SOURCE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_TEMPERATURE_SOURCE },
+	{ PID_BRIGHTNESS_ALERT_ACTIVATION_LEVEL, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_BRIGHTNESS_ALERT_ACTIVATION_LEVEL },
+	{ PID_HYSTERESIS, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_HYSTERESIS },
+	{ PID_FROST_ALARM_ACTIVATION_LEVEL, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_FROST_ALARM_ACTIVATION_LEVEL },
+	{ PID_WIND_FORCE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_WIND_FORCE },
+	{ PID_CONTACT_TYPE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CONTACT_TYPE },
+	{ PID_BEHAVIOUR_ON_MALFUNCTION_HEATING, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_BEHAVIOUR_ON_MALFUNCTION_HEATING },
+	{ PID_PWM_PERIOD, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_PWM_PERIOD },
+	{ PID_TRIGGER_DURATION, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_TRIGGER_DURATION },
+	{ PID_MOVEMENT_DETECTOR_SWITCH_ON_CONDITIONS, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_MOVEMENT_DETECTOR_SWITCH_ON_CONDITIONS },
+	{ PID_TOTAL_BLINDS_MOVEMENT_TIME_DOWN, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_TOTAL_BLINDS_MOVEMENT_TIME_DOWN },
+	{ PID_TOTAL_BLINDS_MOVEMENT_TIME_CALIBRATED_DOWN, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_TOTAL_BLINDS_MOVEMENT_TIME_CALIBRATED_DOWN },
+	{ PID_ENGINE_SWITCH_ON_DELAY_TIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_ENGINE_SWITCH_ON_DELAY_TIME },
+	{ PID_DEVICE_CHANNEL_SELECTOR, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_DEVICE_CHANNEL_SELECTOR },
+	{ PID_TRANSMISSION_INTERVAL, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_TRANSMISSION_INTERVAL },
+	{ PID_FAN_COIL_FAN_SPEED, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_FAN_COIL_FAN_SPEED },
+	{ PID_FAN_COIL_NIGHT_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_FAN_COIL_NIGHT_MODE },
+	{ PID_FAN_COIL_FAN_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_FAN_COIL_FAN_MODE },
+	{ PID_FAN_COIL_FAN_STARTUP_TIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_FAN_COIL_FAN_STARTUP_TIME },
+	{ PID_FAN_COIL_FAN_CHANGEOVER_DELAY, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_FAN_COIL_FAN_CHANGEOVER_DELAY },
+	{ PID_CONTACT_TYPE_A, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CONTACT_TYPE_A },
+	{ PID_CONTACT_TYPE_B, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CONTACT_TYPE_B },
+	{ PID_FAN_COIL_VALVE_OPENING_TIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_FAN_COIL_VALVE_OPENING_TIME },
+	{ PID_FAN_COIL_PWM_PROFILE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_FAN_COIL_PWM_PROFILE },
+	{ PID_SENSOR_TYPE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_SENSOR_TYPE },
+	{ PID_FAN_COIL_VALVE_3POINT, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_FAN_COIL_VALVE_3POINT },
+	{ PID_FAN_COIL_VALVE_NCNO, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_FAN_COIL_VALVE_NCNO },
+	{ PID_PRIMARY_FUNCTION, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_PRIMARY_FUNCTION },
+	{ PID_ALERT_ACTIVATION_DELAY, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_ALERT_ACTIVATION_DELAY },
+	{ PID_DEALERT_ACTIVATION_DELAY, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_DEALERT_ACTIVATION_DELAY },
+	{ PID_RAIN_SENSOR_SENSITIVITY, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_RAIN_SENSOR_SENSITIVITY },
+	{ PID_HOURS_PER_DAY, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_HOURS_PER_DAY },
+	{ PID_USER_LANGUAGE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_USER_LANGUAGE },
+	{ PID_EFFECTIVE_USER_LANGUAGE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_EFFECTIVE_USER_LANGUAGE },
+	{ PID_TEMP_SENSOR_USAGE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_TEMP_SENSOR_USAGE },
+	{ PID_EXT_TEMP_OFFSET, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_EXT_TEMP_OFFSET },
+	{ PID_TEMP_LIMIT, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_TEMP_LIMIT },
+	{ PID_ACOUSTIC_FEEDBACK, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_ACOUSTIC_FEEDBACK },
+	{ PID_REFERENCE_DRIVE_BEFORE_POSITIONING, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_REFERENCE_DRIVE_BEFORE_POSITIONING },
+	{ PID_PROVIDE_TEMPERATURE, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_PROVIDE_TEMPERATURE },
+	{ PID_HC_ACTIVE_THRESHOLD, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_HC_ACTIVE_THRESHOLD },
+	{ PID_POWER_SAVING_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_POWER_SAVING_MODE },
+	{ PID_HANDLE_WIND_ALARM, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_HANDLE_WIND_ALARM },
+	{ PID_HANDLE_RAIN_ALARM, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_HANDLE_RAIN_ALARM },
+	{ PID_HANDLE_FROST_ALARM, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_HANDLE_FROST_ALARM },
+	{ PID_HANDLE_WINDOW_ALARM, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_HANDLE_WINDOW_ALARM },
+	{ PID_BEHAVIOUR_DISABLE_FORCE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_BEHAVIOUR_DISABLE_FORCE },
+	{ PID_SONOS_GROUP_BIT_POSITION, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SONOS_GROUP_BIT_POSITION },
+	{ PID_SONOS_SENSOR_BEHAVIOUR, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_SONOS_SENSOR_BEHAVIOUR },
+	{ PID_SONOS_PLAYER_VOLUME_LIMIT, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SONOS_PLAYER_VOLUME_LIMIT },
+	{ PID_CEILING_FAN_SWITCH_ON_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CEILING_FAN_SWITCH_ON_MODE },
+	{ PID_CFAT0_MINIMUM_FAN_SPEED, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_CFAT0_MINIMUM_FAN_SPEED },
+	{ PID_CFAT0_MAXIMUM_FAN_SPEED, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_CFAT0_MAXIMUM_FAN_SPEED },
+	{ PID_TEMPERATURE_UNIT, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_TEMPERATURE_UNIT },
+	{ PID_EFFECTIVE_TEMPERATURE_UNIT, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_EFFECTIVE_TEMPERATURE_UNIT },
+	{ PID_AWAKE_INDICATOR, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_AWAKE_INDICATOR },
+	{ PID_HEATING_FIRST_STAGE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_HEATING_FIRST_STAGE },
+	{ PID_HEATING_SECOND_STAGE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_HEATING_SECOND_STAGE },
+	{ PID_COOLING_FIRST_STAGE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_COOLING_FIRST_STAGE },
+	{ PID_COOLING_SECOND_STAGE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_COOLING_SECOND_STAGE },
+	{ PID_REVERSING_VALVE_OPMODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_REVERSING_VALVE_OPMODE },
+	{ PID_AUX_TYPE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_AUX_TYPE },
+	{ PID_COMPRESSOR_DELAY, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_COMPRESSOR_DELAY },
+	{ PID_TEMPERATURE_EXTRACT_HEAT, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_TEMPERATURE_EXTRACT_HEAT },
+	{ PID_TEMPERATURE_EXTRACT_COOL, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_TEMPERATURE_EXTRACT_COOL },
+	{ PID_VALUES_IN_ACTIVE_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_VALUES_IN_ACTIVE_MODE },
+	{ PID_SHOW_TEMPERATURE_WHILE_OFF, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_SHOW_TEMPERATURE_WHILE_OFF },
+	{ PID_SHORTCUT_FOR_FAN, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SHORTCUT_FOR_FAN },
+	{ PID_SHORTCUT_FOR_HEAT, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SHORTCUT_FOR_HEAT },
+	{ PID_SHORTCUT_FOR_COOL, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SHORTCUT_FOR_COOL },
+	{ PID_SHORTCUT_FOR_AUX, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SHORTCUT_FOR_AUX },
+	{ PID_SHORTCUT_FOR_ECO, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SHORTCUT_FOR_ECO },
+	{ PID_SHORTCUT_FOR_OFF, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SHORTCUT_FOR_OFF },
+	{ PID_FAN_MANUAL_RUNTIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_FAN_MANUAL_RUNTIME },
+	{ PID_DELAY_FOR_EXIT_MODE, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_DELAY_FOR_EXIT_MODE },
+	{ PID_PROTECTION_HIGH_LIMIT, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_PROTECTION_HIGH_LIMIT },
+	{ PID_PROTECTION_LOW_LIMIT, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_PROTECTION_LOW_LIMIT },
+	{ PID_MINIMUM_ON_TIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_MINIMUM_ON_TIME },
+	{ PID_FAN_ON_TIME_LAG, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_FAN_ON_TIME_LAG },
+	{ PID_FAN_OFF_TIME_LAG, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_FAN_OFF_TIME_LAG },
+	{ PID_COMPRESSOR_LOCKOUT, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_COMPRESSOR_LOCKOUT },
+	{ PID_HEAT_PUMP_AUX_HEAT_LOCKOUT, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_HEAT_PUMP_AUX_HEAT_LOCKOUT },
+	{ PID_FIRST_STAGE_COMP_CYCLE_RATE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_FIRST_STAGE_COMP_CYCLE_RATE },
+	{ PID_SECOND_STAGE_COMP_CYCLE_RATE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SECOND_STAGE_COMP_CYCLE_RATE },
+	{ PID_FIRST_STAGE_HEAT_CYCLE_RATE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_FIRST_STAGE_HEAT_CYCLE_RATE },
+	{ PID_SECOND_STAGE_HEAT_CYCLE_RATE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SECOND_STAGE_HEAT_CYCLE_RATE },
+	{ PID_EMERGENCY_HEAT_CYCLE_RATE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_EMERGENCY_HEAT_CYCLE_RATE },
+	{ PID_FAN_CONTROL, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_FAN_CONTROL },
+	{ PID_HEAT_PUMP_TIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_HEAT_PUMP_TIME },
+	{ PID_HIGH_COOL_LATCH, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_HIGH_COOL_LATCH },
+	{ PID_HIGH_HEAT_LATCH, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_HIGH_HEAT_LATCH },
+	{ PID_COOLING_HYSTERESIS, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_COOLING_HYSTERESIS },
+	{ PID_HEATING_HYSTERESIS, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_HEATING_HYSTERESIS },
+	{ PID_HC_SWITCH_DELAY, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_HC_SWITCH_DELAY },
+	{ PID_MAXIMUM_SETPOINT_TEMPERATURE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_MAXIMUM_SETPOINT_TEMPERATURE },
+	{ PID_MINIMUM_SETPOINT_TEMPERATURE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_MINIMUM_SETPOINT_TEMPERATURE },
+	{ PID_STAGING_TIMER_OVERRIDE, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_STAGING_TIMER_OVERRIDE },
+	{ PID_ARMING_OPTION, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_ARMING_OPTION },
+	{ PID_DAY_OF_WEEK, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DAY_OF_WEEK },
+	{ PID_START_TIME, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_START_TIME },
+	{ PID_END_TIME, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_END_TIME },
+	{ PID_ARM_DELAY, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_ARM_DELAY },
+	{ PID_SILENT_MODE, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_SILENT_MODE },
+	{ PID_PAIRING_PARTNER_PRODUCTION_NUMBER, FAH_PARAM_TYPES::FAH_PARAM_STRING, PNAME_PAIRING_PARTNER_PRODUCTION_NUMBER },
+	{ PID_PAIRING_PARTNER_MANUFACTURER, FAH_PARAM_TYPES::FAH_PARAM_STRING, PNAME_PAIRING_PARTNER_MANUFACTURER },
+	{ PID_SWITCH_OFF_DELAY_MIN, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_SWITCH_OFF_DELAY_MIN },
+	{ PID_TWO_LEVEL_CONTROLLER_HYSTERESIS, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_TWO_LEVEL_CONTROLLER_HYSTERESIS },
+	{ PID_LED_BRIGHTNESS, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_LED_BRIGHTNESS },
+	{ PID_LED_OFF_AT_NIGHT, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_LED_OFF_AT_NIGHT },
+	{ PID_USER_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_USER_MODE },
+	{ PID_INTERNAL_SIREN, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_INTERNAL_SIREN },
+	{ PID_WIZARD_COMPLETED, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_WIZARD_COMPLETED },
+	{ PID_TWILIGHT_BRIGHTNESS, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_TWILIGHT_BRIGHTNESS },
+	{ PID_WIRING, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_WIRING },
+	{ PID_WIND_SPEED_UNIT, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_WIND_SPEED_UNIT },
+	{ PID_EFFECTIVE_WIND_SPEED_UNIT, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_EFFECTIVE_WIND_SPEED_UNIT },
+	{ PID_FAN_LEVEL_STEP_WIDTH, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_FAN_LEVEL_STEP_WIDTH },
+	{ PID_DIMMING_ACTUATOR_TYPE2_LOAD_TYPE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_DIMMING_ACTUATOR_TYPE2_LOAD_TYPE },
+	{ PID_RESET_MANUAL_FAN_STAGE, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_RESET_MANUAL_FAN_STAGE },
+	{ PID_USE_MASTER_MEASURED_TEMPERATURE, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_USE_MASTER_MEASURED_TEMPERATURE },
+	{ PID_LIMIT_TEMPERATURE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_LIMIT_TEMPERATURE },
+	{ PID_SEND_IR_TELEGRAM, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_SEND_IR_TELEGRAM },
+	{ PID_LOCK_ON_SITE_OPERATION, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_LOCK_ON_SITE_OPERATION },
+	{ PID_USE_TEMPLATE, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_USE_TEMPLATE },
+	{ PID_OPENER_CONTACT, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_OPENER_CONTACT },
+	{ PID_OUTPUT_EXECUTES_CENTRAL_INPUT, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_OUTPUT_EXECUTES_CENTRAL_INPUT },
+	{ PID_POWER_ON_LEVEL, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_POWER_ON_LEVEL },
+	{ PID_SYSTEM_FAILURE_LEVEL, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SYSTEM_FAILURE_LEVEL },
+	{ PID_CHANNEL_SELECTOR_AUX_INPUT_SHUTTER, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_AUX_INPUT_SHUTTER },
+	{ PID_CHANNEL_SELECTOR_AUX_INPUT_SWITCH, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_AUX_INPUT_SWITCH },
+	{ PID_CHANNEL_SELECTOR_1_GANG, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_1_GANG },
+	{ PID_CHANNEL_SELECTOR_3_GANG, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_3_GANG },
+	{ PID_VOLUME_SETUP, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_VOLUME_SETUP },
+	{ PID_AUTO_RELOCK_TIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_AUTO_RELOCK_TIME },
+	{ PID_ALBUM_COVER_URL, FAH_PARAM_TYPES::FAH_PARAM_STRING, PNAME_ALBUM_COVER_URL },
+	{ PID_ZSTICK_CONTROL, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_ZSTICK_CONTROL },
+	{ PID_TEMPERATURE_COLOR_PHYSICAL_COOLEST, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_TEMPERATURE_COLOR_PHYSICAL_COOLEST },
+	{ PID_TEMPERATURE_COLOR_PHYSICAL_WARMEST, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_TEMPERATURE_COLOR_PHYSICAL_WARMEST },
+	{ PID_DOMUS_SCENE_DISARMING, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_DOMUS_SCENE_DISARMING },
+	{ PID_DOMUS_DISABLE_INTERNAL_BUZZER, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_DOMUS_DISABLE_INTERNAL_BUZZER },
+	{ PID_DOMUS_ALARM_ON_BURGLARY, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_DOMUS_ALARM_ON_BURGLARY },
+	{ PID_OPERATION_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_OPERATION_MODE },
+	{ PID_DETECTION_AREA, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DETECTION_AREA },
+	{ PID_MOVEMENT_DETECTOR_TEST_MODE, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_MOVEMENT_DETECTOR_TEST_MODE },
+	{ PID_BLIND_SENSOR_OPERATION_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_BLIND_SENSOR_OPERATION_MODE },
+	{ PID_SWITCH_OFF_PREWARNING, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SWITCH_OFF_PREWARNING },
+	{ PID_HEATING_ACTUATOR_PAUSE_TIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_HEATING_ACTUATOR_PAUSE_TIME },
+	{ PID_ACOUSTIC_FEEDBACK_VOLUME, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_ACOUSTIC_FEEDBACK_VOLUME },
+	{ PID_COLOR_THEME, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_COLOR_THEME },
+	{ PID_BRIGHTNESS_FOR_SWITCHING_TO_DARK_MODE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_BRIGHTNESS_FOR_SWITCHING_TO_DARK_MODE },
+	{ PID_AUTOMATIC_RETURN_TO_START_PAGE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_AUTOMATIC_RETURN_TO_START_PAGE },
+	{ PID_BRIGHTNESS_ADJUSTED_TO_AMBIENT_LIGHT, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_BRIGHTNESS_ADJUSTED_TO_AMBIENT_LIGHT },
+	{ PID_SWITCH_DISPLAY_OFF_WHEN_ROOM_IS_DARK, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_SWITCH_DISPLAY_OFF_WHEN_ROOM_IS_DARK },
+	{ PID_BRIGHTNESS_LEVEL_FOR_SWITCHING_TO_DARK, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_BRIGHTNESS_LEVEL_FOR_SWITCHING_TO_DARK },
+	{ PID_SWITCH_OFF_TIME_AFTER_DARK, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_SWITCH_OFF_TIME_AFTER_DARK },
+	{ PID_USE_PROXIMITY_SENSOR, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_USE_PROXIMITY_SENSOR },
+	{ PID_PROXIMITY_SENSOR_SENSITIVITY, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_PROXIMITY_SENSOR_SENSITIVITY },
+	{ PID_HAPTIC_FEEDBACK, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_HAPTIC_FEEDBACK },
+	{ PID_SCEEN_SAVER, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SCEEN_SAVER },
+	{ PID_SCEEN_SAVER_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_SCEEN_SAVER_MODE },
+	{ PID_AUTOMATIC_RETURN, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_AUTOMATIC_RETURN },
+	{ PID_CHANNEL_SELECTOR_MOVEMENT_DETECTOR, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_MOVEMENT_DETECTOR },
+	{ PID_CHANNEL_SELECTOR_AUX_INPUT_SWITCH_1_GANG, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_AUX_INPUT_SWITCH_1_GANG },
+	{ PID_CHANNEL_SELECTOR_CONNECTED_VALVES, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_CONNECTED_VALVES },
+	{ PID_CHANNEL_SELECTOR_CHANNEL_1, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_CHANNEL_1 },
+	{ PID_CHANNEL_SELECTOR_CHANNEL_2, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_CHANNEL_2 },
+	{ PID_CHANNEL_SELECTOR_CHANNEL_3, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_CHANNEL_3 },
+	{ PID_CHANNEL_SELECTOR_CHANNEL_4, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_CHANNEL_4 },
+	{ PID_CHANNEL_SELECTOR_CHANNEL_5, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_CHANNEL_5 },
+	{ PID_CHANNEL_SELECTOR_CHANNEL_6, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_CHANNEL_6 },
+	{ PID_DOMUS_USER_INSTALLER, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_USER_INSTALLER },
+	{ PID_DOMUS_USER_0, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_USER_0 },
+	{ PID_DOMUS_USER_1, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_USER_1 },
+	{ PID_DOMUS_USER_2, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_USER_2 },
+	{ PID_DOMUS_USER_3, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_USER_3 },
+	{ PID_DOMUS_USER_4, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_USER_4 },
+	{ PID_DOMUS_USER_5, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_USER_5 },
+	{ PID_DOMUS_USER_6, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_USER_6 },
+	{ PID_DOMUS_USER_7, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_USER_7 },
+	{ PID_DOMUS_USER_8, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_USER_8 },
+	{ PID_DOMUS_KEY_0, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_KEY_0 },
+	{ PID_DOMUS_KEY_1, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_KEY_1 },
+	{ PID_DOMUS_KEY_2, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_KEY_2 },
+	{ PID_DOMUS_KEY_3, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_KEY_3 },
+	{ PID_DOMUS_KEY_4, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_KEY_4 },
+	{ PID_DOMUS_SIREN_INTRUSION_RINGTONE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_DOMUS_SIREN_INTRUSION_RINGTONE },
+	{ PID_DOMUS_SIREN_INTRUSION_LED, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_DOMUS_SIREN_INTRUSION_LED },
+	{ PID_DOMUS_SIREN_SAFETY_RINGTONE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_DOMUS_SIREN_SAFETY_RINGTONE },
+	{ PID_DOMUS_SIREN_SAFETY_LED, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_DOMUS_SIREN_SAFETY_LED },
+	{ PID_CHANNEL_SELECTOR_MWIRE_ROCKER_1GANG, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_MWIRE_ROCKER_1GANG },
+	{ PID_CHANNEL_SELECTOR_MWIRE_ROCKER_2GANG, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_MWIRE_ROCKER_2GANG },
+	{ PID_DOMUS_SELECTED_REPEATER, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DOMUS_SELECTED_REPEATER },
+	{ PID_CHANNEL_SELECTOR_MWIRE_MOVEMENT_DETECTOR, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_MWIRE_MOVEMENT_DETECTOR },
+	{ PID_CHANNEL_SELECTOR_FUNCTION_INPUT_A, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_FUNCTION_INPUT_A },
+	{ PID_CHANNEL_SELECTOR_FUNCTION_INPUT_B, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_FUNCTION_INPUT_B },
+	{ PID_BI_CONTACT_TYPE_INPUT_A, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_BI_CONTACT_TYPE_INPUT_A },
+	{ PID_BI_CONTACT_TYPE_INPUT_B, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_BI_CONTACT_TYPE_INPUT_B },
+	{ PID_DIMMING_ACTUATOR_MAX_BRIGHTNESS, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_DIMMING_ACTUATOR_MAX_BRIGHTNESS },
+	{ PID_HEIGHT_ABOVE_SEA, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_HEIGHT_ABOVE_SEA },
+	{ PID_CALDION_UI_DURING_NON_USE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CALDION_UI_DURING_NON_USE },
+	{ PID_IGNORE_LOCAL_TEMPERATURE, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_IGNORE_LOCAL_TEMPERATURE },
+	{ PID_PRESENCE_DETECTOR_SWITCH_ON_CONDITION, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_PRESENCE_DETECTOR_SWITCH_ON_CONDITION },
+	{ PID_PRESENCE_DETECTOR_SWITCH_ON_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_PRESENCE_DETECTOR_SWITCH_ON_MODE },
+	{ PID_PRESENCE_DETECTOR_TARGET_BRIGHTNESS, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_PRESENCE_DETECTOR_TARGET_BRIGHTNESS },
+	{ PID_BASIC_SETPOINT_HEATING_COMFORT, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_BASIC_SETPOINT_HEATING_COMFORT },
+	{ PID_BASIC_SETPOINT_HEATING_ECO_MODE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_BASIC_SETPOINT_HEATING_ECO_MODE },
+	{ PID_BASIC_SETPOINT_COOLING_COMFORT, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_BASIC_SETPOINT_COOLING_COMFORT },
+	{ PID_BASIC_SETPOINT_COOLING_ECO_MODE, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_BASIC_SETPOINT_COOLING_ECO_MODE },
+	{ PID_TEMPERATURE_LOWER_LIMIT_FLOOR, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_TEMPERATURE_LOWER_LIMIT_FLOOR },
+	{ PID_TEMPERATURE_UPPER_LIMIT_FLOOR, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_TEMPERATURE_UPPER_LIMIT_FLOOR },
+	{ PID_ADAPTIVE_TIMER_CONTROL, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_ADAPTIVE_TIMER_CONTROL },
+	{ PID_EXTERNAL_INPUT_FUNCTION, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_EXTERNAL_INPUT_FUNCTION },
+	{ PID_CONTROLLER_TYPE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CONTROLLER_TYPE },
+	{ PID_BUILDING_PROTECTION, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_BUILDING_PROTECTION },
+	{ PID_VALVE_PROTECTION, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_VALVE_PROTECTION },
+	{ PID_EXTERNAL_TEMPERATURE_SENSOR_TYPE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_EXTERNAL_TEMPERATURE_SENSOR_TYPE },
+	{ PID_SWITCH_OVER_TO_HEATING, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SWITCH_OVER_TO_HEATING },
+	{ PID_SWITCH_OVER_TO_COOLING, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SWITCH_OVER_TO_COOLING },
+	{ PID_BOOSTER_TIMER, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_BOOSTER_TIMER },
+	{ PID_SWITCHING_CAPACITY, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SWITCHING_CAPACITY },
+	{ PID_PIR_1_SENSITIVITY, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_PIR_1_SENSITIVITY },
+	{ PID_PIR_2_SENSITIVITY, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_PIR_2_SENSITIVITY },
+	{ PID_PIR_3_SENSITIVITY, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_PIR_3_SENSITIVITY },
+	{ PID_PIR_4_SENSITIVITY, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_PIR_4_SENSITIVITY },
+	{ PID_PIR_1_ACTIVE, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_PIR_1_ACTIVE },
+	{ PID_PIR_2_ACTIVE, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_PIR_2_ACTIVE },
+	{ PID_PIR_3_ACTIVE, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_PIR_3_ACTIVE },
+	{ PID_PIR_4_ACTIVE, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_PIR_4_ACTIVE },
+	{ PID_SWITCH_ON_DELAY, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_SWITCH_ON_DELAY },
+	{ PID_CHANNEL_SELECTOR_RTC_ASSIGNED_ROCKER, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_RTC_ASSIGNED_ROCKER },
+	{ PID_CO2_ALERT_ACTIVATION_LEVEL, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_CO2_ALERT_ACTIVATION_LEVEL },
+	{ PID_VOC_ALERT_ACTIVATION_LEVEL, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_VOC_ALERT_ACTIVATION_LEVEL },
+	{ PID_DISPLAY_IDLE_TIME, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_DISPLAY_IDLE_TIME },
+	{ PID_STD_RTC_UI_DURING_NON_USE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_STD_RTC_UI_DURING_NON_USE },
+	{ PID_HUMIDITY_ALERT_LOWER_LIMIT, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_HUMIDITY_ALERT_LOWER_LIMIT },
+	{ PID_HUMIDITY_ALERT_UPPER_LIMIT, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_HUMIDITY_ALERT_UPPER_LIMIT },
+	{ PID_ENABLE_CO2_ALERT, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_ENABLE_CO2_ALERT },
+	{ PID_ENABLE_VOC_ALERT, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_ENABLE_VOC_ALERT },
+	{ PID_ENABLE_HUMIDITY_ALERT, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_ENABLE_HUMIDITY_ALERT },
+	{ PID_FEATURE_SELECTOR, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_FEATURE_SELECTOR },
+	{ PID_REDUCED_LAYOUT, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_REDUCED_LAYOUT },
+	{ PID_MOUNTED_IN_SOLID_WALL, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_MOUNTED_IN_SOLID_WALL },
+	{ PID_ENGINE_SWITCH_ON_DELAY_TIME_NEW, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_ENGINE_SWITCH_ON_DELAY_TIME_NEW },
+	{ PID_SCENE_BACKGROUND_IMG, FAH_PARAM_TYPES::FAH_PARAM_STRING, PNAME_SCENE_BACKGROUND_IMG },
+	{ PID_LED_COLOR, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_LED_COLOR },
+	{ PID_SWITCH_ROCKER_BUTTONS, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_SWITCH_ROCKER_BUTTONS },
+	{ PID_ROCKER_ORIENTATION, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_ROCKER_ORIENTATION },
+	{ PID_FEATURE_ORIENTATION, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_FEATURE_ORIENTATION },
+	{ PID_FEATURE_RGB_SUPPORT, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_FEATURE_RGB_SUPPORT },
+	{ PID_FEATURE_SWITCH_ROCKER_BUTTONS, FAH_PARAM_TYPES::FAH_PARAM_BOOL, PNAME_FEATURE_SWITCH_ROCKER_BUTTONS },
+	{ PID_USER_DEFINED_COLOR, FAH_PARAM_TYPES::FAH_PARAM_NUMBER, PNAME_USER_DEFINED_COLOR },
+	{ PID_CHANNEL_SELECTOR_GENERIC_GANG, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_CHANNEL_SELECTOR_GENERIC_GANG },
+	{ PID_SWITCH_ACTUATOR_OPERATION_MODE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_SWITCH_ACTUATOR_OPERATION_MODE },
+	{ PID_FORCE_MODE_DURATION_TYPE, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_FORCE_MODE_DURATION_TYPE },
+	{ PID_FORCE_MODE_AUTONOMOUS_SWITCH_OFF_TIME_DURATION, FAH_PARAM_TYPES::FAH_PARAM_DURATION, PNAME_FORCE_MODE_AUTONOMOUS_SWITCH_OFF_TIME_DURATION },
+	{ PID_LOW_ENERGY_DEVICE_CHANNEL_SELECTOR, FAH_PARAM_TYPES::FAH_PARAM_ENUM, PNAME_LOW_ENERGY_DEVICE_CHANNEL_SELECTOR },
+	{ PID_LOW_ENERGY_DEVICE_ADDRESS, FAH_PARAM_TYPES::FAH_PARAM_STRING, PNAME_LOW_ENERGY_DEVICE_ADDRESS },
+};
+
+static_assert(FahIsSortedByID(ParamInfoTable), "ParamInfoTable must be sorted by ID");
+
+uint16_t FahParamTable::Count()
+{
+	return sizeof(ParamInfoTable) / sizeof(ParamInfoTable[0]);
+}
+
+bool FahParamTable::Find(const uint16_t& ID, FahParamInfo& Info)
+{
+	int16_t low = 0;
+	int16_t high = Count() - 1;
+	while (low <= high)
+	{
+		int16_t mid = (low + high) / 2;
+		uint16_t midID = pgm_read_word(&ParamInfoTable[mid].ID);
+		if (midID == ID)
+		{
+			Info.ID = midID;
+			Info.Type = (FAH_PARAM_TYPE)pgm_read_byte(&ParamInfoTable[mid].Type);
+			Info.Name = (const char*)pgm_read_ptr(&ParamInfoTable[mid].Name);
+			return true;
+		}
+		if (midID < ID)
+			low = mid + 1;
+		else
+			high = mid - 1;
+	}
+	return false;
+}
+
+FAH_PARAM_TYPE FahParamTable::GetType(const uint16_t& ID)
+{
+	FahParamInfo info;
+	if (!Find(ID, info))
+		return FAH_PARAM_TYPES::FAH_PARAM_UNKNOWN;
+	return info.Type;
+}
+
+String FahParamTable::GetName(const uint16_t& ID)
+{
+	FahParamInfo info;
+	if (!Find(ID, info))
+		return String(ID, HEX);
+	return String(FPSTR(info.Name));
+}
+
+bool FahParamTable::Dispatch(const FahParamHandler* Handlers, const uint8_t& HandlerCount, void* Context, const String& strChannel, const uint16_t& Parameter, const String& strValue)
+{
+	//Handlers are sorted by ID
+	int16_t low = 0;
+	int16_t high = HandlerCount - 1;
+	while (low <= high)
+	{
+		int16_t mid = (low + high) / 2;
+		const FahParamHandler& handler = Handlers[mid];
+		if (handler.ID == Parameter)
+		{
+			switch (handler.Kind)
+			{
+				case FahParamHandler::KIND_INT:
+					handler.OnInt(Context, strChannel, strValue.toInt());
+					break;
+				case FahParamHandler::KIND_FLOAT:
+					handler.OnFloat(Context, strChannel, strValue.toFloat());
+					break;
+				case FahParamHandler::KIND_BOOL:
+					handler.OnBool(Context, strChannel, strValue.toInt() != 0 || strValue.equalsIgnoreCase(F("true")));
+					break;
+				default:
+					handler.OnString(Context, strChannel, strValue);
+					break;
+			}
+			return true;
+		}
+		if (handler.ID < Parameter)
+			low = mid + 1;
+		else
+			high = mid - 1;
+	}
+	return false;
+}
@@ -0,0 +1,82 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include <Arduino.h>
+#include "FahParamDefinitions.h"
+
+namespace FAH_PARAM_TYPES
+{
+	enum FAH_PARAM_TYPE :uint8_t
+	{
+		FAH_PARAM_NUMBER = 0,
+		FAH_PARAM_BOOL = 1,
+		FAH_PARAM_ENUM = 2,
+		FAH_PARAM_DURATION = 3,
+		FAH_PARAM_STRING = 4,
+		FAH_PARAM_UNKNOWN = 0xFF,
+	};
+}
+typedef FAH_PARAM_TYPES::FAH_PARAM_TYPE FAH_PARAM_TYPE;
+
+//Entry of the parameter table, stored in flash
+struct FahParamInfo
+{
+	uint16_t ID;
+	FAH_PARAM_TYPE Type;
+	const char* Name; //PROGMEM string, PID_ name without the prefix
+};
+
+typedef void (*FAH_PARAM_INT_HANDLER)(void* Context, const String& strChannel, const int32_t& Value);
+typedef void (*FAH_PARAM_FLOAT_HANDLER)(void* Context, const String& strChannel, const float& Value);
+typedef void (*FAH_PARAM_BOOL_HANDLER)(void* Context, const String& strChannel, const bool& Value);
+typedef void (*FAH_PARAM_STRING_HANDLER)(void* Context, const String& strChannel, const String& Value);
+
+//Handler for one parameter, the value is converted to the type of the handler
+struct FahParamHandler
+{
+	enum HandlerKind :uint8_t { KIND_INT, KIND_FLOAT, KIND_BOOL, KIND_STRING };
+	uint16_t ID;
+	HandlerKind Kind;
+	union
+	{
+		FAH_PARAM_INT_HANDLER OnInt;
+		FAH_PARAM_FLOAT_HANDLER OnFloat;
+		FAH_PARAM_BOOL_HANDLER OnBool;
+		FAH_PARAM_STRING_HANDLER OnString;
+	};
+	constexpr FahParamHandler(const uint16_t ID, FAH_PARAM_INT_HANDLER Handler) : ID(ID), Kind(KIND_INT), OnInt(Handler) {}
+	constexpr FahParamHandler(const uint16_t ID, FAH_PARAM_FLOAT_HANDLER Handler) : ID(ID), Kind(KIND_FLOAT), OnFloat(Handler) {}
+	constexpr FahParamHandler(const uint16_t ID, FAH_PARAM_BOOL_HANDLER Handler) : ID(ID), Kind(KIND_BOOL), OnBool(Handler) {}
+	constexpr FahParamHandler(const uint16_t ID, FAH_PARAM_STRING_HANDLER Handler) : ID(ID), Kind(KIND_STRING), OnString(Handler) {}
+};
+
+//Compile time check that a table is sorted by ID, for use in static_assert
+template<typename T, size_t N> constexpr bool FahIsSortedByID(const T(&Table)[N], const size_t Index = 1)
+{
+	return Index >= N || (Table[Index - 1].ID < Table[Index].ID && FahIsSortedByID(Table, Index + 1));
+}
+
+class FahParamTable
+{
+public:
+	static bool Find(const uint16_t& ID, FahParamInfo& Info);
+	//Best effort guess from the parameter name, the SysAP does not publish the types; Dispatch converts to the type of the handler instead
+	static FAH_PARAM_TYPE GetType(const uint16_t& ID);
+	static String GetName(const uint16_t& ID);
+	static uint16_t Count();
+	static bool Dispatch(const FahParamHandler* Handlers, const uint8_t& HandlerCount, void* Context, const String& strChannel, const uint16_t& Parameter, const String& strValue);
+	template<uint8_t N> static bool Dispatch(const FahParamHandler(&Handlers)[N], void* Context, const String& strChannel, const uint16_t& Parameter, const String& strValue)
+	{
+		return Dispatch(Handlers, N, Context, strChannel, Parameter, strValue);
+	}
+};
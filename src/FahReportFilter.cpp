@@ -0,0 +1,116 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahReportFilter.h"
+
+FahReportFilter::FahReportFilter(const float& AbsoluteDeadband, const float& RelativeDeadband, const unsigned long& MinIntervalMs, const unsigned long& MaxIntervalMs)
+{
+	Configure(AbsoluteDeadband, RelativeDeadband, MinIntervalMs, MaxIntervalMs);
+}
+
+void FahReportFilter::Configure(const float& AbsoluteDeadband, const float& RelativeDeadband, const unsigned long& MinIntervalMs, const unsigned long& MaxIntervalMs)
+{
+	this->AbsoluteDeadband = AbsoluteDeadband;
+	this->RelativeDeadband = RelativeDeadband;
+	this->MinIntervalMs = MinIntervalMs;
+	this->MaxIntervalMs = MaxIntervalMs;
+}
+
+bool FahReportFilter::isChanged(const float& Value)
+{
+	float delta = fabs(Value - ReportedValue);
+	float threshold = RelativeDeadband * fabs(ReportedValue);
+	if (AbsoluteDeadband > threshold)
+		threshold = AbsoluteDeadband;
+
+	if (threshold <= 0)
+		return delta > 0;
+	return delta >= threshold;
+}
+
+bool FahReportFilter::Offer(const float& Value, const bool& Force)
+{
+	OfferedValue = Value;
+	if (Force || !hasReported)
+		return true;
+
+	if (!isChanged(Value))
+	{
+		//Back within the deadband, a value held back by the minimum interval is no longer needed
+		isPending = false;
+		return false;
+	}
+
+	if ((millis() - ReportedMillis) < MinIntervalMs)
+	{
+		//Send the latest value once the minimum interval has passed
+		PendingValue = Value;
+		isPending = true;
+		return false;
+	}
+	return true;
+}
+
+void FahReportFilter::Reported(const float& Value)
+{
+	ReportedValue = Value;
+	OfferedValue = Value;
+	ReportedMillis = millis();
+	hasReported = true;
+	isPending = false;
+}
+
+void FahReportFilter::Postpone()
+{
+	//Sending failed, keep the value and try again after the minimum interval or heartbeat
+	ReportedMillis = millis();
+}
+
+bool FahReportFilter::isDue(float& Value)
+{
+	if (!hasReported)
+		return false;
+
+	unsigned long elapsed = millis() - ReportedMillis;
+	if (isPending && elapsed >= MinIntervalMs)
+	{
+		Value = PendingValue;
+		return true;
+	}
+	if (MaxIntervalMs > 0 && elapsed >= MaxIntervalMs)
+	{
+		//The current reading, a value drifting within the deadband is not repeated stale
+		Value = OfferedValue;
+		return true;
+	}
+	return false;
+}
+
+unsigned long FahReportFilter::MillisUntilDue()
+{
+	unsigned long result = (unsigned long)-1;
+	if (!hasReported)
+		return result;
+
+	unsigned long elapsed = millis() - ReportedMillis;
+	if (isPending)
+	{
+		result = elapsed >= MinIntervalMs ? 0 : MinIntervalMs - elapsed;
+	}
+	if (MaxIntervalMs > 0)
+	{
+		unsigned long heartbeat = elapsed >= MaxIntervalMs ? 0 : MaxIntervalMs - elapsed;
+		if (heartbeat < result)
+			result = heartbeat;
+	}
+	return result;
+}
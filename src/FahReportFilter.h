@@ -0,0 +1,42 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include <Arduino.h>
+
+//Decides when a sensor value is sent: on a change beyond the deadband, not more often than
+//MinIntervalMs, and at least every MaxIntervalMs as heartbeat
+class FahReportFilter
+{
+public:
+	FahReportFilter(const float& AbsoluteDeadband, const float& RelativeDeadband, const unsigned long& MinIntervalMs, const unsigned long& MaxIntervalMs);
+	void Configure(const float& AbsoluteDeadband, const float& RelativeDeadband, const unsigned long& MinIntervalMs, const unsigned long& MaxIntervalMs);
+	bool Offer(const float& Value, const bool& Force);
+	void Reported(const float& Value);
+	void Postpone();
+	bool isDue(float& Value);
+	unsigned long MillisUntilDue();
+	bool hasReportedValue() { return hasReported; };
+	float GetReportedValue() { return ReportedValue; };
+private:
+	float AbsoluteDeadband = 0; //Change needed before a new value is sent
+	float RelativeDeadband = 0; //Change needed as fraction of the last sent value
+	unsigned long MinIntervalMs = 0;
+	unsigned long MaxIntervalMs = 0; //0 disables the heartbeat
+	float ReportedValue = 0;
+	float PendingValue = 0;
+	float OfferedValue = 0; //Latest value offered, sent by the heartbeat
+	unsigned long ReportedMillis = 0;
+	bool hasReported = false;
+	bool isPending = false;
+	bool isChanged(const float& Value);
+};
@@ -0,0 +1,47 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahSysAPInfo.h"
+#ifdef ESP32
+	#include <WiFi.h>
+#else
+	#include <ESP8266WiFi.h>
+#endif
+
+bool FahSysAPInfo::ResolveAddress(IPAddress& Address)
+{
+	if (AddressValid && (millis() - AddressResolvedMillis) < FAH_SYSAP_ADDRESS_TTL_MS)
+	{
+		Address = CachedAddress;
+		return true;
+	}
+
+	//Hostname can be an IP address already, no lookup needed
+	if (!CachedAddress.fromString(Hostname))
+	{
+		if (WiFi.hostByName(Hostname.c_str(), CachedAddress) != 1)
+		{
+			DEBUG_P(F("Failed to resolve: ")); DEBUG_PL(Hostname);
+			AddressValid = false;
+			return false;
+		}
+	}
+	AddressValid = true;
+	AddressResolvedMillis = millis();
+	Address = CachedAddress;
+	return true;
+}
+
+void FahSysAPInfo::InvalidateAddress()
+{
+	AddressValid = false;
+}
@@ -11,6 +11,8 @@
 *
 **************************************************************************************************************/
 #pragma once
+#include "FahCircuitBreaker.h"
+
 class FahSysAPInfo
 {
 	public:
@@ -18,4 +20,22 @@ class FahSysAPInfo
 		bool secure = false;
 		uint16_t port = 80;
 		String authorizationHeader = "";
+		String RequestHeaders = "";
+		FahCircuitBreaker ConnectBreaker;
+		//Address of Hostname, shared by all connections and only looked up again after a failed connect or the TTL
+		bool ResolveAddress(IPAddress& Address);
+		void InvalidateAddress();
+		//Renders the headers sent with every REST request, once per SysAP session
+		void RenderRequestHeaders()
+		{
+			RequestHeaders = String(F("Content-Type: application/json\r\nAccept: application/json\r\nHost: sysap\r\n"));
+			if (authorizationHeader.length() != 0)
+			{
+				RequestHeaders += String(F("Authorization: ")) + authorizationHeader + String(F("\r\n"));
+			}
+		}
+	private:
+		IPAddress CachedAddress;
+		bool AddressValid = false;
+		unsigned long AddressResolvedMillis = 0;
 };
@@ -0,0 +1,176 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahTimerQueue.h"
+
+FahTimerQueue::FahTimerQueue(TimerEntry* Storage, const uint16_t& Capacity)
+{
+	if (Storage == NULL)
+	{
+		Storage = new TimerEntry[Capacity];
+		OwnsHeap = true;
+	}
+	this->Heap = Storage;
+	this->Capacity = Capacity;
+}
+
+FahTimerQueue::~FahTimerQueue()
+{
+	if (OwnsHeap)
+		delete[] Heap;
+}
+
+bool FahTimerQueue::isBefore(const TimerEntry& a, const TimerEntry& b)
+{
+	//Wrap safe for deadlines less than ~24 days apart
+	return (long)(a.Deadline - b.Deadline) < 0;
+}
+
+int32_t FahTimerQueue::FindHandle(const FAH_TIMER_HANDLE& Handle)
+{
+	if (Handle == 0)
+		return -1;
+
+	for (uint16_t i = 0; i < Count; i++)
+	{
+		if (Heap[i].Handle == Handle)
+			return i;
+	}
+	return -1;
+}
+
+void FahTimerQueue::SiftUp(uint16_t Index)
+{
+	while (Index > 0)
+	{
+		uint16_t parent = (Index - 1) / 2;
+		if (!isBefore(Heap[Index], Heap[parent]))
+			break;
+		TimerEntry tmp = Heap[parent];
+		Heap[parent] = Heap[Index];
+		Heap[Index] = tmp;
+		Index = parent;
+	}
+}
+
+void FahTimerQueue::SiftDown(uint16_t Index)
+{
+	while (true)
+	{
+		uint16_t smallest = Index;
+		uint32_t left = (uint32_t)Index * 2 + 1;
+		uint32_t right = left + 1;
+		if (left < Count && isBefore(Heap[left], Heap[smallest]))
+			smallest = left;
+		if (right < Count && isBefore(Heap[right], Heap[smallest]))
+			smallest = right;
+		if (smallest == Index)
+			break;
+		TimerEntry tmp = Heap[smallest];
+		Heap[smallest] = Heap[Index];
+		Heap[Index] = tmp;
+		Index = smallest;
+	}
+}
+
+void FahTimerQueue::RemoveAt(const uint16_t& Index)
+{
+	Count--;
+	if (Index == Count)
+		return;
+
+	Heap[Index] = Heap[Count];
+	if (Index > 0 && isBefore(Heap[Index], Heap[(Index - 1) / 2]))
+		SiftUp(Index);
+	else
+		SiftDown(Index);
+}
+
+FAH_TIMER_HANDLE FahTimerQueue::Schedule(const unsigned long& DelayMs, FAH_TIMER_CALLBACK Callback, void* Context, const uint8_t& TimerID)
+{
+	if (Count == Capacity || Callback == NULL)
+	{
+		DEBUG_PL(F("Timer queue full"));
+		return 0;
+	}
+
+	//Next handle that is not in use, 0 is reserved for 'no timer'
+	do
+	{
+		LastHandle++;
+	} while (LastHandle == 0 || FindHandle(LastHandle) >= 0);
+
+	TimerEntry& entry = Heap[Count];
+	entry.Deadline = millis() + DelayMs;
+	entry.Callback = Callback;
+	entry.Context = Context;
+	entry.TimerID = TimerID;
+	entry.Handle = LastHandle;
+	Count++;
+	SiftUp(Count - 1);
+	return LastHandle;
+}
+
+bool FahTimerQueue::Cancel(FAH_TIMER_HANDLE& Handle)
+{
+	int32_t index = FindHandle(Handle);
+	Handle = 0;
+	if (index < 0)
+		return false;
+
+	RemoveAt(index);
+	return true;
+}
+
+void FahTimerQueue::CancelAll(void* Context)
+{
+	uint16_t kept = 0;
+	for (uint16_t i = 0; i < Count; i++)
+	{
+		if (Heap[i].Context != Context)
+			Heap[kept++] = Heap[i];
+	}
+	if (kept == Count)
+		return;
+
+	//Restore the heap order over the remaining entries
+	Count = kept;
+	for (int32_t i = (Count / 2) - 1; i >= 0; i--)
+		SiftDown(i);
+}
+
+bool FahTimerQueue::isScheduled(const FAH_TIMER_HANDLE& Handle)
+{
+	return FindHandle(Handle) >= 0;
+}
+
+bool FahTimerQueue::MillisUntilNext(unsigned long& Millis)
+{
+	if (Count == 0)
+		return false;
+
+	long remaining = (long)(Heap[0].Deadline - millis());
+	Millis = remaining > 0 ? remaining : 0;
+	return true;
+}
+
+void FahTimerQueue::Process()
+{
+	//Only the root needs to be checked, callbacks may schedule new timers
+	unsigned long now = millis();
+	while (Count > 0 && (long)(now - Heap[0].Deadline) >= 0)
+	{
+		TimerEntry expired = Heap[0];
+		RemoveAt(0);
+		expired.Callback(expired.Context, expired.TimerID);
+	}
+}
@@ -0,0 +1,56 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include <Arduino.h>
+#include "FahESPBuildConfig.h"
+
+//Called when a timer expires, TimerID is the value passed to Schedule
+typedef void (*FAH_TIMER_CALLBACK)(void* Context, const uint8_t& TimerID);
+
+typedef uint16_t FAH_TIMER_HANDLE; //0 is no timer
+
+//Fixed size min-heap of one shot timers, the next deadline is always at the root
+class FahTimerQueue
+{
+public:
+	struct TimerEntry
+	{
+		unsigned long Deadline = 0;
+		FAH_TIMER_CALLBACK Callback = NULL;
+		void* Context = NULL;
+		uint8_t TimerID = 0;
+		FAH_TIMER_HANDLE Handle = 0;
+	};
+	//Storage of Capacity entries supplied by the owner, or allocated once when NULL
+	FahTimerQueue(TimerEntry* Storage, const uint16_t& Capacity);
+	~FahTimerQueue();
+	FAH_TIMER_HANDLE Schedule(const unsigned long& DelayMs, FAH_TIMER_CALLBACK Callback, void* Context, const uint8_t& TimerID);
+	bool Cancel(FAH_TIMER_HANDLE& Handle);
+	void CancelAll(void* Context);
+	bool isScheduled(const FAH_TIMER_HANDLE& Handle);
+	bool MillisUntilNext(unsigned long& Millis);
+	void Process();
+	uint16_t GetCount() { return Count; };
+	uint16_t GetCapacity() { return Capacity; };
+private:
+	TimerEntry* Heap = NULL;
+	uint16_t Capacity = 0;
+	bool OwnsHeap = false;
+	uint16_t Count = 0;
+	FAH_TIMER_HANDLE LastHandle = 0;
+	static bool isBefore(const TimerEntry& a, const TimerEntry& b);
+	int32_t FindHandle(const FAH_TIMER_HANDLE& Handle);
+	void SiftUp(uint16_t Index);
+	void SiftDown(uint16_t Index);
+	void RemoveAt(const uint16_t& Index);
+};
@@ -0,0 +1,75 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahTokenBucket.h"
+
+#define TOKEN_UNIT 1000
+
+FahTokenBucket::FahTokenBucket(const uint16_t& RatePerSecond, const uint8_t& Burst)
+{
+	Configure(RatePerSecond, Burst);
+}
+
+void FahTokenBucket::Configure(const uint16_t& RatePerSecond, const uint8_t& Burst)
+{
+	//Rate is in tokens per second, which equals 1/1000 tokens per millisecond
+	this->Rate = RatePerSecond;
+	this->Capacity = (uint32_t)(Burst > 0 ? Burst : 1) * TOKEN_UNIT;
+	this->Tokens = this->Capacity;
+	this->LastRefillMillis = millis();
+}
+
+void FahTokenBucket::Refill()
+{
+	unsigned long now = millis();
+	unsigned long elapsed = now - LastRefillMillis;
+	if (elapsed == 0)
+		return;
+
+	LastRefillMillis = now;
+	if (elapsed >= (Capacity / Rate) + 1)
+	{
+		//Long idle, bucket is full (also avoids overflow of elapsed * Rate)
+		Tokens = Capacity;
+	}
+	else
+	{
+		Tokens += elapsed * Rate;
+		if (Tokens > Capacity)
+			Tokens = Capacity;
+	}
+}
+
+bool FahTokenBucket::TryAcquire()
+{
+	if (Rate == 0)
+		return true; //Rate limiting disabled
+
+	Refill();
+	if (Tokens >= TOKEN_UNIT)
+	{
+		Tokens -= TOKEN_UNIT;
+		return true;
+	}
+	return false;
+}
+
+unsigned long FahTokenBucket::MillisUntilAvailable()
+{
+	if (Rate == 0)
+		return 0;
+
+	Refill();
+	if (Tokens >= TOKEN_UNIT)
+		return 0;
+	return ((TOKEN_UNIT - Tokens) + Rate - 1) / Rate;
+}
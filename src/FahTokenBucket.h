@@ -0,0 +1,31 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include <Arduino.h>
+#include "FahESPBuildConfig.h"
+
+//Millisecond based token bucket, tokens are kept in 1/1000 units to avoid floating point
+class FahTokenBucket
+{
+public:
+	FahTokenBucket(const uint16_t& RatePerSecond, const uint8_t& Burst);
+	void Configure(const uint16_t& RatePerSecond, const uint8_t& Burst);
+	bool TryAcquire();
+	unsigned long MillisUntilAvailable();
+private:
+	void Refill();
+	uint32_t Tokens = 0;
+	uint32_t Capacity = 0;
+	uint16_t Rate = 0;
+	unsigned long LastRefillMillis = 0;
+};
@@ -0,0 +1,145 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#include "FahWeatherAggregator.h"
+
+void FahSensorWindow::AddSample(const float& Value)
+{
+	if (Count == 0 || Value < Min)
+		Min = Value;
+	if (Count == 0 || Value > Max)
+		Max = Value;
+	Last = Value;
+	Sum += Value;
+	Count++;
+
+	//Peak of the short moving average, a gust is a sustained maximum and not a single sample
+	Recent[RecentIndex] = Value;
+	RecentIndex = (RecentIndex + 1) % FAH_GUST_AVERAGE_SAMPLES;
+	if (RecentCount < FAH_GUST_AVERAGE_SAMPLES)
+		RecentCount++;
+
+	float recentSum = 0;
+	for (uint8_t i = 0; i < RecentCount; i++)
+		recentSum += Recent[i];
+	float average = recentSum / RecentCount;
+	if (Count == 1 || average > Peak)
+		Peak = average;
+}
+
+void FahSensorWindow::Reset()
+{
+	//The moving average continues over the window boundary
+	Count = 0;
+	Sum = 0;
+	Min = 0;
+	Max = 0;
+	Peak = 0;
+}
+
+FahWeatherAggregator::FahWeatherAggregator(FahESPWeatherStation* Station, const unsigned long& PublishIntervalMs)
+{
+	this->Station = Station;
+	this->PublishIntervalMs = PublishIntervalMs;
+	LastPublishMillis = millis();
+}
+
+void FahWeatherAggregator::AddBrightnessLux(const uint16_t& Level)
+{
+	Windows[FAH_WEATHER_SENSORS::FAH_WS_BRIGHTNESS].AddSample(Level);
+	process();
+}
+
+void FahWeatherAggregator::AddBrightnessByAnalogSensor(const uint8_t& Pin)
+{
+	//Same conversion as FahESPWeatherStation::SetBrightnessLevelByAnalogSensor
+	uint16_t val = analogRead(Pin);
+	val = val * ((val / 10) + 1);
+	AddBrightnessLux(val);
+}
+
+void FahWeatherAggregator::AddTemperature(const float& Temperature)
+{
+	Windows[FAH_WEATHER_SENSORS::FAH_WS_TEMPERATURE].AddSample(Temperature);
+	process();
+}
+
+void FahWeatherAggregator::AddRain(const float& AmountOfRain, const bool& isRaining)
+{
+	Windows[FAH_WEATHER_SENSORS::FAH_WS_RAIN].AddSample(AmountOfRain);
+	if (isRaining)
+		RainSeen = true;
+	process();
+}
+
+void FahWeatherAggregator::AddWindSpeed(const float& SpeedMS)
+{
+	Windows[FAH_WEATHER_SENSORS::FAH_WS_WIND_FORCE].AddSample(SpeedMS);
+	process();
+}
+
+uint8_t FahWeatherAggregator::SpeedToBeaufort(const float& SpeedMS)
+{
+	//Upper wind speed in m/s of Beaufort 0 to 11
+	static const float BeaufortLimits[] = { 0.3, 1.6, 3.4, 5.5, 8.0, 10.8, 13.9, 17.2, 20.8, 24.5, 28.5, 32.7 };
+	uint8_t beaufort = 0;
+	while (beaufort < sizeof(BeaufortLimits) / sizeof(BeaufortLimits[0]) && SpeedMS >= BeaufortLimits[beaufort])
+		beaufort++;
+	return beaufort;
+}
+
+bool FahWeatherAggregator::process()
+{
+	if ((millis() - LastPublishMillis) < PublishIntervalMs)
+		return false;
+
+	Publish();
+	return true;
+}
+
+void FahWeatherAggregator::Publish()
+{
+	if (Station == NULL)
+		return;
+
+	FahWeatherUpdate update;
+	FahSensorWindow& brightness = Windows[FAH_WEATHER_SENSORS::FAH_WS_BRIGHTNESS];
+	if (brightness.hasSamples())
+		update.SetBrightnessLux(brightness.GetMean() + 0.5f);
+
+	FahSensorWindow& rain = Windows[FAH_WEATHER_SENSORS::FAH_WS_RAIN];
+	if (rain.hasSamples())
+		update.SetRain(rain.GetMax(), RainSeen);
+
+	FahSensorWindow& temperature = Windows[FAH_WEATHER_SENSORS::FAH_WS_TEMPERATURE];
+	if (temperature.hasSamples())
+		update.SetTemperature(temperature.GetMean());
+
+	//Wind force from the mean speed, the gust from the peak over the window
+	FahSensorWindow& wind = Windows[FAH_WEATHER_SENSORS::FAH_WS_WIND_FORCE];
+	if (wind.hasSamples())
+	{
+		update.SetWindForce(SpeedToBeaufort(wind.GetMean()));
+		update.SetWindGust(wind.GetPeak());
+	}
+
+	if (!Station->Update(update))
+	{
+		//Queue of the station is full, keep collecting and try again with the next sample
+		return;
+	}
+
+	LastPublishMillis = millis();
+	for (uint8_t i = 0; i <= FAH_WEATHER_SENSORS::FAH_WS_WIND_FORCE; i++)
+		Windows[i].Reset();
+	RainSeen = false;
+}
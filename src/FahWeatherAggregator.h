@@ -0,0 +1,64 @@
+/*************************************************************************************************************
+*
+* Title			    : Free-ESPatHome
+* Description:      : Library that implements the Busch-Jeager / ABB Free@Home API for ESP8266 and ESP32.
+* Version		    : v 0.12
+* Last updated      : 2023.12.13
+* Target		    : ESP32, ESP8266, ESP8285
+* Author            : Roeland Kluit
+* Web               : https://github.com/roelandkluit/Free-ESPatHome
+* License           : GPL-3.0 license
+*
+**************************************************************************************************************/
+#pragma once
+#include "FahESPBuildConfig.h"
+#include "FahESPWeatherStation.h"
+
+//Min, max, mean and last of the samples since the last Reset, and the peak of the
+//moving average over the last FAH_GUST_AVERAGE_SAMPLES samples
+class FahSensorWindow
+{
+public:
+	void AddSample(const float& Value);
+	void Reset();
+	bool hasSamples() { return Count > 0; };
+	uint32_t GetCount() { return Count; };
+	float GetMin() { return Min; };
+	float GetMax() { return Max; };
+	float GetMean() { return Count > 0 ? Sum / Count : 0; };
+	float GetLast() { return Last; };
+	float GetPeak() { return Peak; };
+private:
+	float Min = 0;
+	float Max = 0;
+	float Sum = 0;
+	float Last = 0;
+	float Peak = 0;
+	uint32_t Count = 0;
+	float Recent[FAH_GUST_AVERAGE_SAMPLES];
+	uint8_t RecentIndex = 0;
+	uint8_t RecentCount = 0;
+};
+
+//Collects fast sensor samples and publishes the aggregate to a weather station once per interval
+class FahWeatherAggregator
+{
+public:
+	FahWeatherAggregator(FahESPWeatherStation* Station, const unsigned long& PublishIntervalMs = FAH_WS_PUBLISH_INTERVAL_MS);
+	void AddBrightnessLux(const uint16_t& Level);
+	void AddBrightnessByAnalogSensor(const uint8_t& Pin);
+	void AddTemperature(const float& Temperature);
+	void AddRain(const float& AmountOfRain, const bool& isRaining);
+	void AddWindSpeed(const float& SpeedMS);
+	void SetPublishInterval(const unsigned long& PublishIntervalMs) { this->PublishIntervalMs = PublishIntervalMs; };
+	bool process();
+	void Publish();
+	FahSensorWindow& GetWindow(const FAH_WEATHER_SENSOR& Sensor) { return Windows[Sensor < FAH_WEATHER_SENSORS::FAH_WS_WIND_GUST ? Sensor : FAH_WEATHER_SENSORS::FAH_WS_WIND_FORCE]; };
+	static uint8_t SpeedToBeaufort(const float& SpeedMS);
+private:
+	FahESPWeatherStation* Station = NULL;
+	FahSensorWindow Windows[FAH_WEATHER_SENSORS::FAH_WS_WIND_FORCE + 1]; //Wind force and gust share the wind speed window
+	bool RainSeen = false;
+	unsigned long PublishIntervalMs = 0;
+	unsigned long LastPublishMillis = 0;
+};
@@ -12,22 +12,26 @@
 **************************************************************************************************************/
 #include "FreeAtHomeESPapi.h"
 #include "FahESPSwitchDevice.h"
+#include "FahESPGenericDevice.h"
 #include <base64.h>
 #include "FahESPWeatherStation.h"
 
-const String FreeAtHomeESPapi::KEY_ROOT = "00000000-0000-0000-0000-000000000000";
-const String FreeAtHomeESPapi::KEY_DATAPOINTS = "datapoints";
-const String FreeAtHomeESPapi::KEY_CHANNELS = "channels";
-const String FreeAtHomeESPapi::KEY_OUTPUTS = "outputs";
-const String FreeAtHomeESPapi::KEY_INPUTS = "inputs";
-const String FreeAtHomeESPapi::KEY_VALUE = "value";
-const String FreeAtHomeESPapi::KEY_VALUES = "values";
-const String FreeAtHomeESPapi::KEY_DEVICES = "devices";
-const String FreeAtHomeESPapi::KEY_DISPLAYNAME = "displayName";
-const String FreeAtHomeESPapi::KEY_SCENESTRIGGERED = "scenesTriggered";
-const String FreeAtHomeESPapi::KEY_PARAMETERS = "parameters";
-const String FreeAtHomeESPapi::VALUE_0 = "0";
-const String FreeAtHomeESPapi::VALUE_1 = "1";
+constexpr char FreeAtHomeESPapi::KEY_ROOT[] PROGMEM;
+constexpr char FreeAtHomeESPapi::KEY_DATAPOINTS[] PROGMEM;
+constexpr char FreeAtHomeESPapi::KEY_CHANNELS[] PROGMEM;
+constexpr char FreeAtHomeESPapi::KEY_OUTPUTS[] PROGMEM;
+constexpr char FreeAtHomeESPapi::KEY_INPUTS[] PROGMEM;
+constexpr char FreeAtHomeESPapi::KEY_VALUE[] PROGMEM;
+constexpr char FreeAtHomeESPapi::KEY_VALUES[] PROGMEM;
+constexpr char FreeAtHomeESPapi::KEY_DEVICES[] PROGMEM;
+constexpr char FreeAtHomeESPapi::KEY_DISPLAYNAME[] PROGMEM;
+constexpr char FreeAtHomeESPapi::KEY_SCENESTRIGGERED[] PROGMEM;
+constexpr char FreeAtHomeESPapi::KEY_PARAMETERS[] PROGMEM;
+constexpr char FreeAtHomeESPapi::VALUE_0[] PROGMEM;
+constexpr char FreeAtHomeESPapi::VALUE_1[] PROGMEM;
+constexpr char FreeAtHomeESPapi::URI_VIRTUALDEVICE[] PROGMEM;
+constexpr char FreeAtHomeESPapi::URI_DATAPOINT[] PROGMEM;
+constexpr char FreeAtHomeESPapi::URI_DEVICE[] PROGMEM;
 
 String FreeAtHomeESPapi::GetIDPString(const uint8_t &Number)
 {
@@ -98,10 +102,21 @@ void FreeAtHomeESPapi::U64toStringDev(const uint64_t number, String& stringref)
 	stringref.toUpperCase();
 }
 
-FreeAtHomeESPapi::FreeAtHomeESPapi()
+FreeAtHomeESPapi::FreeAtHomeESPapi() :FreeAtHomeESPapi(FahCapacitiesOf<FahDefaultCapacityPolicy>(), NULL, NULL)
+{
+}
+
+FreeAtHomeESPapi::FreeAtHomeESPapi(const FahCapacities& Capacities, PendingDeviceCreation* CreationStorage, FahTimerQueue::TimerEntry* TimerStorage)
+	:Capacities(Capacities), EspDevices(Capacities.MaxDevices), Timers(TimerStorage, Capacities.MaxTimers)
 {
 	callbacks = NULL;	
 	ws = NULL;
+	if (CreationStorage == NULL)
+	{
+		CreationStorage = new PendingDeviceCreation[Capacities.MaxPendingCreations];
+		OwnsCreationStorage = true;
+	}
+	PendingCreations = CreationStorage;
 }
 
 FreeAtHomeESPapi::~FreeAtHomeESPapi()
@@ -116,62 +131,98 @@ FreeAtHomeESPapi::~FreeAtHomeESPapi()
 		delete ws;
 		ws = NULL;
 	}
+	for (uint8_t i = 0; i < Capacities.MaxPendingCreations; i++)
+	{
+		if (PendingCreations[i].httpclt != NULL)
+		{
+			delete PendingCreations[i].httpclt;
+			PendingCreations[i].httpclt = NULL;
+		}
+	}
+	if (OwnsCreationStorage)
+		delete[] PendingCreations;
 }
 
 bool FreeAtHomeESPapi::RegisterFahEspDevice(FahESPDevice *Device)
 {
-	for (uint8_t i = 0; i < MAX_ESP_CREATED_DEVICES; i++)
+	if (Device == NULL)
 	{
-		if(EspDevices[i] == NULL)
-		{
-			if (Device != NULL)
-			{
-				EspDevices[i] = Device;
-			}
-			return true;
-		}
+		return EspDevices.Count() < Capacities.MaxDevices;
 	}
-	return false;
+	return EspDevices.Add(Device) != 0;
 }
 
 bool FreeAtHomeESPapi::RemoveDevice(FahESPDevice* Device)
 {
-	for (uint8_t i = 0; i < MAX_ESP_CREATED_DEVICES; i++)
+	if (EspDevices.Remove(Device))
 	{
-		if (EspDevices[i] == Device)
-		{
-			delete Device;
-			EspDevices[i] = NULL;
-			return true;
-		}
+		delete Device;
+		return true;
 	}
 	return false;
 }
 
+FAH_DEVICE_HANDLE FreeAtHomeESPapi::GetDeviceHandle(FahESPDevice* Device)
+{
+	if (Device == NULL || EspDevices.Find(Device->GetFahDeviceID()) != Device)
+		return 0;
+	return EspDevices.GetHandle(Device->GetFahDeviceID());
+}
+
+FahESPDevice* FreeAtHomeESPapi::GetDeviceByHandle(const FAH_DEVICE_HANDLE& Handle)
+{
+	return EspDevices.GetByHandle(Handle);
+}
+
+FahESPDevice* FreeAtHomeESPapi::GetDeviceByFahID(const uint64_t& FahID)
+{
+	return EspDevices.Find(FahID);
+}
+
 FahESPSwitchDevice* FreeAtHomeESPapi::CreateSwitchDevice(const String& SerialNr, const String& DisplayName, const uint16_t& timeout)
 {
-	return (FahESPSwitchDevice*)CreateDevice(SerialNr, FahESPSwitchDevice::ConstStringDeviceType, DisplayName, timeout);
+	return (FahESPSwitchDevice*)CreateDevice(SerialNr, String(FahESPSwitchDevice::ConstStringDeviceType), DisplayName, timeout);
 }
 
 FahESPWeatherStation* FreeAtHomeESPapi::CreateWeatherStation(const String& SerialNr, const String& DisplayName, const uint16_t& timeout)
 {
-	return (FahESPWeatherStation*)CreateDevice(SerialNr, FahESPWeatherStation::ConstStringDeviceType, DisplayName, timeout);
+	return (FahESPWeatherStation*)CreateDevice(SerialNr, String(FahESPWeatherStation::ConstStringDeviceType), DisplayName, timeout);
 }
 
-FahESPDevice* FreeAtHomeESPapi::CreateDevice(const String& SerialNr, const String& deviceType, const String& DisplayName, const uint16_t& timeout)
+FahESPGenericDevice* FreeAtHomeESPapi::CreateGenericDevice(const String& SerialNr, const FahDeviceSchema& Schema, const String& DisplayName, const uint16_t& timeout)
+{
+	return (FahESPGenericDevice*)CreateDeviceWithSchema(SerialNr, String(Schema.DeviceType), &Schema, DisplayName, timeout);
+}
+
+uint8_t FreeAtHomeESPapi::CreateSwitchDeviceAsync(const String& SerialNr, const String& DisplayName, const uint16_t& timeout, FAHESP_DEVICE_CREATED_CALLBACK Callback, void* Context)
+{
+	return CreateDeviceAsync(SerialNr, String(FahESPSwitchDevice::ConstStringDeviceType), DisplayName, timeout, Callback, Context);
+}
+
+uint8_t FreeAtHomeESPapi::CreateWeatherStationAsync(const String& SerialNr, const String& DisplayName, const uint16_t& timeout, FAHESP_DEVICE_CREATED_CALLBACK Callback, void* Context)
+{
+	return CreateDeviceAsync(SerialNr, String(FahESPWeatherStation::ConstStringDeviceType), DisplayName, timeout, Callback, Context);
+}
+
+uint8_t FreeAtHomeESPapi::CreateGenericDeviceAsync(const String& SerialNr, const FahDeviceSchema& Schema, const String& DisplayName, const uint16_t& timeout, FAHESP_DEVICE_CREATED_CALLBACK Callback, void* Context)
+{
+	return CreateDeviceWithSchemaAsync(SerialNr, String(Schema.DeviceType), &Schema, DisplayName, timeout, Callback, Context);
+}
+
+uint8_t FreeAtHomeESPapi::GetFreeDeviceSlots()
 {
-	if (!RegisterFahEspDevice(NULL))
+	uint8_t freeSlots = Capacities.MaxDevices - EspDevices.Count();
+	for (uint8_t i = 0; i < Capacities.MaxPendingCreations; i++)
 	{
-		//No slots available
-		return NULL;
+		//Pending creations have a device slot reserved
+		if (PendingCreations[i].httpclt != NULL && freeSlots > 0)
+			freeSlots--;
 	}
+	return freeSlots;
+}
 
-	if (ws == NULL)
-		return NULL;
-	if (!ws->isConnected())
-		return NULL;
-
-	FahHTTPClient* httpclt = new FahHTTPClient(this->SysApInfo);
+bool FreeAtHomeESPapi::StartDeviceRegistration(FahHTTPClient* httpclt, const String& SerialNr, const String& deviceType, const String& DisplayName, const uint16_t& timeout, const bool& async)
+{
 	String URI = FreeAtHomeESPapi::ConstructDeviceRegistrationURI(SerialNr);
 	String sDisplayName = DisplayName;
 	if (DisplayName.indexOf('"') >= 0)
@@ -181,22 +232,27 @@ FahESPDevice* FreeAtHomeESPapi::CreateDevice(const String& SerialNr, const Strin
 	}
 	String HTTPPostData = FreeAtHomeESPapi::ConstructDeviceRegistrationBody(deviceType, sDisplayName, timeout);
 
-	if (!httpclt->HTTPRequest(String(F("PUT")), URI, HTTPPostData))
-	{
-		DEBUG_PL(F("Registration Failed"));		
-		return NULL;
-	}
+	if (async)
+		return httpclt->HTTPRequestAsync(String(F("PUT")), URI, HTTPPostData);
+	else
+		return httpclt->HTTPRequest(String(F("PUT")), URI, HTTPPostData);
+}
 
+FahESPDevice* FreeAtHomeESPapi::CreateDeviceFromResponse(String& Body, const String& SerialNr, const String& deviceType, const FahDeviceSchema* Schema, const uint16_t& timeout)
+{
 	uint64_t OutFahID;
-	String Body = httpclt->GetBody();
 	if (this->ProcessJsonData(Body, JsonProcessFilter::PROCESS_DEVICES, &OutFahID))
 	{
 		FahESPDevice* outDevice = NULL;
-		if (deviceType == FahESPSwitchDevice::ConstStringDeviceType)
+		if (Schema != NULL)
+		{
+			outDevice = new FahESPGenericDevice(*Schema, OutFahID, SerialNr, timeout, this, this->SysApInfo);
+		}
+		else if (FahFlashString::Equals(deviceType, FahESPSwitchDevice::DeviceTypeName))
 		{
 			outDevice = new FahESPSwitchDevice(OutFahID, SerialNr, timeout, this, this->SysApInfo);
 		}
-		else if (deviceType == FahESPWeatherStation::ConstStringDeviceType)
+		else if (FahFlashString::Equals(deviceType, FahESPWeatherStation::DeviceTypeName))
 		{
 			outDevice = new FahESPWeatherStation(OutFahID, SerialNr, timeout, this, this->SysApInfo);
 		}
@@ -204,12 +260,189 @@ FahESPDevice* FreeAtHomeESPapi::CreateDevice(const String& SerialNr, const Strin
 		{
 			outDevice = new FahESPDevice(deviceType, OutFahID, SerialNr, timeout, this, this->SysApInfo);
 		}
-		RegisterFahEspDevice(outDevice);
+		if (!RegisterFahEspDevice(outDevice))
+		{
+			//No room left or the SysAP returned the ID of a device that already exists
+			delete outDevice;
+			return NULL;
+		}
 		return outDevice;
 	}
 	return NULL;
 }
 
+FahESPDevice* FreeAtHomeESPapi::CreateDevice(const String& SerialNr, const String& deviceType, const String& DisplayName, const uint16_t& timeout)
+{
+	return CreateDeviceWithSchema(SerialNr, deviceType, NULL, DisplayName, timeout);
+}
+
+FahESPDevice* FreeAtHomeESPapi::CreateDeviceWithSchema(const String& SerialNr, const String& deviceType, const FahDeviceSchema* Schema, const String& DisplayName, const uint16_t& timeout)
+{
+	if (GetFreeDeviceSlots() == 0)
+	{
+		//No slots available
+		return NULL;
+	}
+
+	if (ws == NULL)
+		return NULL;
+	if (!ws->isConnected())
+		return NULL;
+
+	FahHTTPClient* httpclt = new FahHTTPClient(this->SysApInfo, Capacities);
+	if (!StartDeviceRegistration(httpclt, SerialNr, deviceType, DisplayName, timeout, false))
+	{
+		DEBUG_PL(F("Registration Failed"));		
+		delete httpclt;
+		return NULL;
+	}
+
+	String Body = httpclt->GetBody();
+	delete httpclt;
+	return CreateDeviceFromResponse(Body, SerialNr, deviceType, Schema, timeout);
+}
+
+uint8_t FreeAtHomeESPapi::CreateDeviceAsync(const String& SerialNr, const String& deviceType, const String& DisplayName, const uint16_t& timeout, FAHESP_DEVICE_CREATED_CALLBACK Callback, void* Context)
+{
+	return CreateDeviceWithSchemaAsync(SerialNr, deviceType, NULL, DisplayName, timeout, Callback, Context);
+}
+
+uint8_t FreeAtHomeESPapi::CreateDeviceWithSchemaAsync(const String& SerialNr, const String& deviceType, const FahDeviceSchema* Schema, const String& DisplayName, const uint16_t& timeout, FAHESP_DEVICE_CREATED_CALLBACK Callback, void* Context)
+{
+	if (GetFreeDeviceSlots() == 0)
+	{
+		//No slots available
+		return 0;
+	}
+
+	if (ws == NULL)
+		return 0;
+	if (!ws->isConnected())
+		return 0;
+
+	for (uint8_t i = 0; i < Capacities.MaxPendingCreations; i++)
+	{
+		PendingDeviceCreation& pending = PendingCreations[i];
+		if (pending.httpclt == NULL)
+		{
+			pending.httpclt = new FahHTTPClient(this->SysApInfo, Capacities);
+			if (!StartDeviceRegistration(pending.httpclt, SerialNr, deviceType, DisplayName, timeout, true))
+			{
+				DEBUG_PL(F("Registration Failed"));
+				delete pending.httpclt;
+				pending.httpclt = NULL;
+				return 0;
+			}
+
+			//Handle 0 is reserved for failure
+			LastCreationHandle++;
+			if (LastCreationHandle == 0)
+				LastCreationHandle++;
+
+			pending.SerialNr = SerialNr;
+			pending.DeviceType = deviceType;
+			pending.Schema = Schema;
+			pending.Timeout = timeout;
+			pending.Handle = LastCreationHandle;
+			pending.Callback = Callback;
+			pending.Context = Context;
+			pending.TimedOut = false;
+			pending.TimeoutTimer = Timers.Schedule(HTTP_SESSION_TIMEOUT_MS, OnTimer, this, TIMER_CREATION_TIMEOUT + i);
+			return pending.Handle;
+		}
+	}
+	//All creation slots in use
+	return 0;
+}
+
+bool FreeAtHomeESPapi::isDeviceCreationPending(const uint8_t& Handle)
+{
+	if (Handle == 0)
+		return false;
+
+	for (uint8_t i = 0; i < Capacities.MaxPendingCreations; i++)
+	{
+		if (PendingCreations[i].httpclt != NULL && PendingCreations[i].Handle == Handle)
+			return true;
+	}
+	return false;
+}
+
+void FreeAtHomeESPapi::ProcessPendingCreations()
+{
+	for (uint8_t i = 0; i < Capacities.MaxPendingCreations; i++)
+	{
+		PendingDeviceCreation& pending = PendingCreations[i];
+		if (pending.httpclt == NULL)
+			continue;
+
+		FahESPDevice* outDevice = NULL;
+		HTTPREQUEST_STATUS status = pending.httpclt->GetAsyncStatus();
+		if (status == HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING)
+		{
+			if (!pending.TimedOut)
+			{
+				pending.httpclt->ProcessAsync();
+				continue;
+			}
+			DEBUG_PL(F("Registration Timeout"));
+		}
+		else if (status == HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_SUCCESS)
+		{
+			String Body = pending.httpclt->GetBody();
+			outDevice = CreateDeviceFromResponse(Body, pending.SerialNr, pending.DeviceType, pending.Schema, pending.Timeout);
+		}
+
+		//Completed, release the slot before the callback so it can start a new creation
+		uint8_t handle = pending.Handle;
+		FAHESP_DEVICE_CREATED_CALLBACK callback = pending.Callback;
+		void* context = pending.Context;
+		Timers.Cancel(pending.TimeoutTimer);
+		delete pending.httpclt;
+		pending.httpclt = NULL;
+		pending.SerialNr = "";
+		pending.DeviceType = "";
+		pending.Schema = NULL;
+		pending.Callback = NULL;
+		pending.Context = NULL;
+
+		if (callback != NULL)
+		{
+			callback(handle, outDevice, context);
+		}
+	}
+}
+
+void FreeAtHomeESPapi::SetRequestRateLimit(const uint16_t& RequestsPerSecond, const uint8_t& Burst)
+{
+	RequestRateLimit.Configure(RequestsPerSecond, Burst);
+}
+
+bool FreeAtHomeESPapi::AcquireRequestToken()
+{
+	return RequestRateLimit.TryAcquire();
+}
+
+void FreeAtHomeESPapi::OnTimer(void* Context, const uint8_t& TimerID)
+{
+	FreeAtHomeESPapi* api = (FreeAtHomeESPapi*)Context;
+	if (TimerID == TIMER_WS_PING)
+	{
+		api->PingTimer = 0;
+		if (api->ws != NULL && api->ws->isConnected())
+		{
+			api->ws->sendPing();
+			api->PingTimer = api->Timers.Schedule(WS_PING_INTERVAL_TIMEOUT, OnTimer, api, TIMER_WS_PING);
+		}
+	}
+	else if (TimerID - TIMER_CREATION_TIMEOUT < api->Capacities.MaxPendingCreations)
+	{
+		PendingDeviceCreation& pending = api->PendingCreations[TimerID - TIMER_CREATION_TIMEOUT];
+		pending.TimeoutTimer = 0;
+		pending.TimedOut = true;
+	}
+}
+
 bool FreeAtHomeESPapi::ConnectToSysAP(const String& SysAPHostname, const String& Username, const String& Password, const bool& useSSL)
 {
 	String encoded = String(F("Basic ")) + base64::encode(Username + ":" + Password);
@@ -248,6 +481,10 @@ bool FreeAtHomeESPapi::ConnectToSysAP(const String& SysAPHostname, const String&
 	{
 		this->SysApInfo = new FahSysAPInfo();
 	}
+	if (this->SysApInfo->Hostname != SysAPHostname)
+	{
+		this->SysApInfo->InvalidateAddress();
+	}
 	this->SysApInfo->Hostname = SysAPHostname;
 	this->SysApInfo->authorizationHeader = AuthorizationHeader;
 	this->SysApInfo->secure = useSSL;
@@ -255,26 +492,30 @@ bool FreeAtHomeESPapi::ConnectToSysAP(const String& SysAPHostname, const String&
 		this->SysApInfo->port = 443;
 	else
 		this->SysApInfo->port = 80;
+	this->SysApInfo->RenderRequestHeaders();
 
 	ws = new WebSocketClient(useSSL);
 	ws->setAuthorizationHeader(AuthorizationHeader);
 	
-	if(!ws->connect(SysAPHostname, F("/fhapi/v1/api/ws"), this->SysApInfo->port))
+	IPAddress address;
+	if (!this->SysApInfo->ResolveAddress(address) || !ws->connect(address, SysAPHostname, F("/fhapi/v1/api/ws"), this->SysApInfo->port))
 	{
+		this->SysApInfo->InvalidateAddress();
 		delete ws;
 		ws = NULL;
 		return false;
 	}
 	else
 	{
-		for (uint8_t i = 0; i < MAX_ESP_CREATED_DEVICES; i++)
+		//SysAP is reachable again, do not wait for the next probe
+		this->SysApInfo->ConnectBreaker.Reset();
+		Timers.Cancel(PingTimer);
+		PingTimer = Timers.Schedule(WS_PING_INTERVAL_TIMEOUT, OnTimer, this, TIMER_WS_PING);
+		for (uint16_t i = 0; i < EspDevices.Count(); i++)
 		{
-			if (EspDevices[i] != NULL)
-			{
-				//Notify virtual devices that the connection was lost and reconnected
-				//Allows virtual devices to get their state from sysAP
-				EspDevices[i]->NotifyOnSysAPReconnect();
-			}
+			//Notify virtual devices that the connection was lost and reconnected
+			//Allows virtual devices to get their state from sysAP
+			EspDevices.GetAt(i)->NotifyOnSysAPReconnect();
 		}
 		return true;
 	}
@@ -286,7 +527,7 @@ bool FreeAtHomeESPapi::ProcessJsonData(String& recievedData, JsonProcessFilter f
 	if (recievedData.length() == 0)
 		return retval;
 
-	DynamicJsonDocument fahJsonMsg(MAX_ARDUINOJSON_DOC_SIZE);
+	DynamicJsonDocument fahJsonMsg(Capacities.JsonDocSize);
 	DeserializationError error = deserializeJson(fahJsonMsg, recievedData);
 
 	if (error)
@@ -297,9 +538,9 @@ bool FreeAtHomeESPapi::ProcessJsonData(String& recievedData, JsonProcessFilter f
 	}
 	else
 	{
-		if (fahJsonMsg.containsKey(KEY_ROOT))
+		if (fahJsonMsg.containsKey(FPSTR(KEY_ROOT)))
 		{
-			JsonObject root = fahJsonMsg[KEY_ROOT].as<JsonObject>();
+			JsonObject root = fahJsonMsg[FPSTR(KEY_ROOT)].as<JsonObject>();
 			JsonObject outDP;
 
 			if ((filter & JsonProcessFilter::PROCESS_DATAPOINTS) == JsonProcessFilter::PROCESS_DATAPOINTS)
@@ -348,13 +589,14 @@ bool FreeAtHomeESPapi::process()
 		}
 		else
 		{
-			for (uint8_t i = 0; i < MAX_ESP_CREATED_DEVICES; i++)
+			//Renewals, refreshes, request timeouts and the websocket ping
+			Timers.Process();
+
+			for (uint16_t i = 0; i < EspDevices.Count(); i++)
 			{
-				if (EspDevices[i] != NULL)
-				{
-					EspDevices[i]->process();
-				}
+				EspDevices.GetAt(i)->process();
 			}
+			ProcessPendingCreations();
 
 			String msg = "";
 			if (ws->getMessage(msg))
@@ -367,7 +609,93 @@ bool FreeAtHomeESPapi::process()
 	return false;
 }
 
-bool FreeAtHomeESPapi::GetStringToken(String& from, String& to, uint8_t index, char separator)
+FAHESPAPI_PROCESS_RESULT FreeAtHomeESPapi::process(const uint32_t& budgetMicros)
+{
+	if (ws == NULL || ((!ws->isConnected()) && (ws->Available() <= 8)))
+	{
+		//Disconnected and no data pending to process
+		return FAHESPAPI_PROCESS_RESULTS::FAHESPAPI_PROCESS_DISCONNECTED;
+	}
+
+	unsigned long startMicros = micros();
+	Timers.Process();
+	ProcessPendingCreations();
+
+	//Alternate between one websocket message and one device step, until nothing is left or the budget is spent
+	bool didWork;
+	do
+	{
+		didWork = false;
+		if (ws->Available() > 0)
+		{
+			String msg = "";
+			if (ws->getMessage(msg))
+			{
+				ProcessJsonData(msg, JsonProcessFilter::PROCESS_ACTIONS, NULL);
+			}
+			didWork = true;
+		}
+
+		FahESPDevice* device = GetNextDeviceWithWork(true);
+		if (device != NULL)
+		{
+			device->process();
+			didWork = true;
+		}
+	} while (didWork && (micros() - startMicros) < budgetMicros);
+
+	if (didWork && (ws->Available() > 0 || GetNextDeviceWithWork(false) != NULL))
+		return FAHESPAPI_PROCESS_RESULTS::FAHESPAPI_PROCESS_WORK_PENDING;
+	return FAHESPAPI_PROCESS_RESULTS::FAHESPAPI_PROCESS_IDLE;
+}
+
+FahESPDevice* FreeAtHomeESPapi::GetNextDeviceWithWork(const bool& Advance)
+{
+	//Round robin, so a busy device cannot keep the others waiting
+	uint16_t count = EspDevices.Count();
+	for (uint16_t n = 0; n < count; n++)
+	{
+		uint16_t i = (NextDeviceIndex + n) % count;
+		FahESPDevice* device = EspDevices.GetAt(i);
+		if (device->hasPendingWork())
+		{
+			if (Advance)
+				NextDeviceIndex = (i + 1) % count;
+			return device;
+		}
+	}
+	return NULL;
+}
+
+unsigned long FreeAtHomeESPapi::NextDeadlineMs()
+{
+	//Disconnected or data waiting, process() has to run now
+	if (ws == NULL || !ws->isConnected() || ws->Available() > 0)
+		return 0;
+
+	//The websocket ping timer runs while connected, so this is never idle forever
+	unsigned long deadline = WS_PING_INTERVAL_TIMEOUT;
+	unsigned long timerMs = 0;
+	if (Timers.MillisUntilNext(timerMs) && timerMs < deadline)
+		deadline = timerMs;
+
+	for (uint16_t i = 0; i < EspDevices.Count() && deadline > 0; i++)
+	{
+		unsigned long deviceMs = EspDevices.GetAt(i)->NextDeadlineMs();
+		if (deviceMs < deadline)
+			deadline = deviceMs;
+	}
+
+	for (uint8_t i = 0; i < Capacities.MaxPendingCreations && deadline > 0; i++)
+	{
+		FahHTTPClient* httpclt = PendingCreations[i].httpclt;
+		if (httpclt != NULL && (httpclt->GetAsyncStatus() != HTTPREQUEST_STATUS::HTTPREQUEST_STATUS_PENDING || httpclt->GetState() < HTTPCLIENT_STATE::HTTPCLIENT_STATE_REQUESTED))
+			deadline = 0;
+	}
+	return deadline;
+}
+
+bool FreeAtHomeESPapi::GetStringToken(const String& from, String& to, uint8_t index, char separator)
 {
 	uint16_t start = 0, idx = 0;
 	uint8_t cur = 0;
@@ -434,25 +762,49 @@ bool FreeAtHomeESPapi::ProcessJsonNewDevice(JsonObject& jsonDevices, uint64_t* h
 
 String FreeAtHomeESPapi::ConstructDeviceRegistrationURI(const String& SerialNr)
 {
-	String URI = String(F("/fhapi/v1/api/rest/virtualdevice/")) + KEY_ROOT + String(F("/")) + SerialNr;
+	String URI;
+	URI.reserve(FahFlashString::Length(URI_VIRTUALDEVICE) + FahFlashString::Length(KEY_ROOT) + 1 + SerialNr.length());
+	URI += FPSTR(URI_VIRTUALDEVICE);
+	URI += FPSTR(KEY_ROOT);
+	URI += KEY_DATAPOINT_SEPERATOR;
+	URI += SerialNr;
 	return URI;
 }
 
 String FreeAtHomeESPapi::ConstructDeviceDataPointNotificationURI(const String& deviceFaHID, const String& channel, const String& datapoint)
 {
-	String URI = ConstructDeviceDataPointNotificationURI(deviceFaHID + String(F(".")) + channel + String(F(".")) + datapoint);
+	String URI;
+	URI.reserve(FahFlashString::Length(URI_DATAPOINT) + FahFlashString::Length(KEY_ROOT) + 3 + deviceFaHID.length() + channel.length() + datapoint.length());
+	URI += FPSTR(URI_DATAPOINT);
+	URI += FPSTR(KEY_ROOT);
+	URI += KEY_DATAPOINT_SEPERATOR;
+	URI += deviceFaHID;
+	URI += '.';
+	URI += channel;
+	URI += '.';
+	URI += datapoint;
 	return URI;
 }
 
 String FreeAtHomeESPapi::ConstructDeviceDataPointNotificationURI(const String& fulldatapoint)
 {
-	String URI = String(F("/fhapi/v1/api/rest/datapoint/")) + KEY_ROOT + String(F("/")) + fulldatapoint;
+	String URI;
+	URI.reserve(FahFlashString::Length(URI_DATAPOINT) + FahFlashString::Length(KEY_ROOT) + 1 + fulldatapoint.length());
+	URI += FPSTR(URI_DATAPOINT);
+	URI += FPSTR(KEY_ROOT);
+	URI += KEY_DATAPOINT_SEPERATOR;
+	URI += fulldatapoint;
 	return URI;
 }
 
 String FreeAtHomeESPapi::ConstructGetDeviceDetailsURI(const String& deviceFaHID)
 {
-	String URI = String(F("/fhapi/v1/api/rest/device/")) + KEY_ROOT + String(F("/")) + deviceFaHID;	
+	String URI;
+	URI.reserve(FahFlashString::Length(URI_DEVICE) + FahFlashString::Length(KEY_ROOT) + 1 + deviceFaHID.length());
+	URI += FPSTR(URI_DEVICE);
+	URI += FPSTR(KEY_ROOT);
+	URI += KEY_DATAPOINT_SEPERATOR;
+	URI += deviceFaHID;
 	return URI;
 }
 
@@ -518,9 +870,9 @@ void FreeAtHomeESPapi::ProcessjsonDataPointValueEntry(JsonObject& jsonDataPoint,
 	{
 		//DEBUG_P("   Datapoint:"); DEBUG_P(datapoint.key().c_str());	DEBUG_P(" = ");
 		valueobject = datapoint.value().as<JsonObject>();
-		if (valueobject.containsKey(KEY_VALUE))
+		if (valueobject.containsKey(FPSTR(KEY_VALUE)))
 		{
-			value = valueobject[KEY_VALUE].as<JsonString>();
+			value = valueobject[FPSTR(KEY_VALUE)].as<JsonString>();
 			//DEBUG_PL(value.c_str());
 			const char* lpCchannel = channel.c_str();
 			const char* lpCDataPoint = datapoint.key().c_str();
@@ -554,7 +906,7 @@ void FreeAtHomeESPapi::NotifyCallbacks(FAHESPAPI_EVENT Event, uint64_t FAHID, co
 		{
 			if(MatchChannelDataPoint(ptrChannel, ptrDataPoint, 0, 0, false))
 			{
-				bNightActuatorForSysAp = (String((const char*)ptrValue) == "1");
+				bNightActuatorForSysAp = FahFlashString::Equals((const char*)ptrValue, VALUE_1);
 				/*for (uint8_t i = 0; i < MAX_ESP_CREATED_DEVICES; i++)
 				{
 					if (EspDevices[i] != NULL)
@@ -566,15 +918,10 @@ void FreeAtHomeESPapi::NotifyCallbacks(FAHESPAPI_EVENT Event, uint64_t FAHID, co
 			}
 		}
 
-		for (uint8_t i = 0; i < MAX_ESP_CREATED_DEVICES; i++)
+		FahESPDevice* device = EspDevices.Find(FAHID);
+		if (device != NULL)
 		{
-			if (EspDevices[i] != NULL)
-			{
-				if (EspDevices[i]->GetFahDeviceID() == FAHID)
-				{
-					EspDevices[i]->NotifyFahDataPoint(String(ptrChannel), String(ptrDataPoint), String((const char*)ptrValue), isSceneOrGetValue);
-				}
-			}
+			device->NotifyFahDataPoint(String(ptrChannel), String(ptrDataPoint), String((const char*)ptrValue), isSceneOrGetValue);
 		}
 	}
 	NotifyCallback(Event, FAHID, ptrChannel, ptrDataPoint, ptrValue);
@@ -585,16 +932,8 @@ bool FreeAtHomeESPapi::isCallbackNeededForHexDevice(uint64_t hexDevice)
 	if (hexDevice == SYSAP_FAH_ID)
 		return true;
 
-	for (uint8_t i = 0; i < MAX_ESP_CREATED_DEVICES; i++)
-	{
-		if (EspDevices[i] != NULL)
-		{
-			if (EspDevices[i]->GetFahDeviceID() == hexDevice)
-			{
-				return true;
-			}
-		}
-	}
+	if (EspDevices.Find(hexDevice) != NULL)
+		return true;
 
 	bool needsInfo = false;
 	for (uint8_t i = 0; i < callbackcount; i++)
@@ -641,24 +980,20 @@ void FreeAtHomeESPapi::ProcessJsonSceneTrigger(JsonObject& jsonSceneTrigger)
 	}
 }
 
-bool FreeAtHomeESPapi::GetNestedJsonObject(JsonPair& input, JsonObject& output, const String& ExpectedSubKey)
+bool FreeAtHomeESPapi::GetNestedJsonObject(JsonPair& input, JsonObject& output, PGM_P ExpectedSubKey)
 {
 	JsonObject ref1 = input.value().as<JsonObject>();
 	return GetKeyIfExistAndGotChildren(ref1, ExpectedSubKey, output);
 }
 
-bool FreeAtHomeESPapi::GetKeyIfExistAndGotChildren(JsonObject& rootObject, const String& LookFor, JsonObject& childRef)
+bool FreeAtHomeESPapi::GetKeyIfExistAndGotChildren(JsonObject& rootObject, PGM_P LookFor, JsonObject& childRef)
 {
-	if (rootObject.containsKey(LookFor))
-	{
-		JsonObject __tchildRef = rootObject[LookFor].as<JsonObject>();
-		if (__tchildRef.size() == 0)
-			return false;
-
-		childRef = __tchildRef;
-		//DEBUG_P(F("GotChild: ")); DEBUG_P(KEY_DATAPOINTS); DEBUG_P(F(", count: ")); DEBUG_PL(__tchildRef.size());
-		return true;
-	}
-	else
+	//A missing key or a value that is not an object gives a null object, its size is 0
+	JsonObject __tchildRef = rootObject[FPSTR(LookFor)].as<JsonObject>();
+	if (__tchildRef.size() == 0)
 		return false;
+
+	childRef = __tchildRef;
+	//DEBUG_P(F("GotChild: ")); DEBUG_P(FPSTR(LookFor)); DEBUG_P(F(", count: ")); DEBUG_PL(__tchildRef.size());
+	return true;
 }
\ No newline at end of file
@@ -28,6 +28,11 @@
 #include "HTTPClient.h"
 #include "FahESPDevice.h"
 #include "FahSysAPInfo.h"
+#include "FahTokenBucket.h"
+#include "FahTimerQueue.h"
+#include "FahDeviceRegistry.h"
+#include "FahFlashString.h"
+#include "FahCapacityPolicy.h"
 
 class FahSysAPInfo;
 
@@ -35,6 +40,25 @@ class FahSysAPInfo;
 class FahESPDevice;
 class FahESPSwitchDevice;
 class FahESPWeatherStation;
+class FahESPGenericDevice;
+struct FahDeviceSchema;
+
+class FahHTTPClient;
+template<class Policy> class FahESPapiStorage;
+
+namespace FAHESPAPI_PROCESS_RESULTS
+{
+	enum FAHESPAPI_PROCESS_RESULT :uint8_t
+	{
+		FAHESPAPI_PROCESS_DISCONNECTED = 0,
+		FAHESPAPI_PROCESS_IDLE = 1, //Nothing left to do, see NextDeadlineMs()
+		FAHESPAPI_PROCESS_WORK_PENDING = 2, //Budget spent before all messages and device steps were handled
+	};
+}
+typedef FAHESPAPI_PROCESS_RESULTS::FAHESPAPI_PROCESS_RESULT FAHESPAPI_PROCESS_RESULT;
+
+//Completion of CreateDeviceAsync, Device is NULL when the SysAP did not create the device
+typedef void (*FAHESP_DEVICE_CREATED_CALLBACK)(const uint8_t& Handle, FahESPDevice* Device, void* Context);
 
 class FreeAtHomeESPapi : public FahEventEnabledClass
 {
@@ -43,11 +67,13 @@ public:
 	static const uint8_t FAHESP_VERSION_MAJOR = 0;
 	static const uint8_t FAHESP_VERSION_MINOR = 12;
 	static String Version() { return String(FAHESP_VERSION_MAJOR) + "." + String(FAHESP_VERSION_MINOR) + String(" - Roeland Kluit"); }
-	FreeAtHomeESPapi();
+	FreeAtHomeESPapi(); //Capacities of FahDefaultCapacityPolicy, see FreeAtHomeESPapiSized for other sizes
 	~FreeAtHomeESPapi();
+	const FahCapacities& GetCapacities() { return Capacities; };
 	bool ConnectToSysAP(const String& SysAPHostname, const String& AuthorizationHeader, const bool& useSSL);
 	bool ConnectToSysAP(const String& SysAPHostname, const String& Username, const String& Password, const bool& useSSL);
 	bool process();
+	FAHESPAPI_PROCESS_RESULT process(const uint32_t& budgetMicros);
 	bool isNightForSysAp();
 	static bool MatchChannelDataPoint(const char* ptrChannel, const char* ptrDataPoint, const uint8_t& Channel, const uint8_t& Datapoint, const bool& isInputDataPoint);
 	static String GetIDPString(const uint8_t &Number);
@@ -58,29 +84,45 @@ public:
 	static String U64toString(const uint64_t number);
 	FahESPSwitchDevice* CreateSwitchDevice(const String& SerialNr, const String& DisplayName, const uint16_t& timeout);
 	FahESPWeatherStation* CreateWeatherStation(const String& SerialNr, const String& DisplayName, const uint16_t& timeout);
+	FahESPGenericDevice* CreateGenericDevice(const String& SerialNr, const FahDeviceSchema& Schema, const String& DisplayName, const uint16_t& timeout);
 	FahESPDevice* CreateDevice(const String& SerialNr, const String& deviceType, const String& DisplayName, const uint16_t& timeout);	
+	uint8_t CreateSwitchDeviceAsync(const String& SerialNr, const String& DisplayName, const uint16_t& timeout, FAHESP_DEVICE_CREATED_CALLBACK Callback, void* Context = NULL);
+	uint8_t CreateWeatherStationAsync(const String& SerialNr, const String& DisplayName, const uint16_t& timeout, FAHESP_DEVICE_CREATED_CALLBACK Callback, void* Context = NULL);
+	uint8_t CreateGenericDeviceAsync(const String& SerialNr, const FahDeviceSchema& Schema, const String& DisplayName, const uint16_t& timeout, FAHESP_DEVICE_CREATED_CALLBACK Callback, void* Context = NULL);
+	uint8_t CreateDeviceAsync(const String& SerialNr, const String& deviceType, const String& DisplayName, const uint16_t& timeout, FAHESP_DEVICE_CREATED_CALLBACK Callback, void* Context = NULL);
+	bool isDeviceCreationPending(const uint8_t& Handle);
 	static String ConstructDeviceRegistrationURI(const String& SerialNr);
 	static String ConstructDeviceRegistrationBody(const String& DeviceType, const String& DisplayName, const uint16_t& Timeout);
 	static String ConstructDeviceDataPointNotificationURI(const String& deviceFaHID, const String& channel, const String& datapoint);
 	static String ConstructDeviceDataPointNotificationURI(const String& fulldatapoint);
 	static String ConstructGetDeviceDetailsURI(const String& deviceFaHID);
-	static bool GetStringToken(String& from, String& to, uint8_t index, char separator);
+	static bool GetStringToken(const String& from, String& to, uint8_t index, char separator);
 	bool RemoveDevice(FahESPDevice* Device);
-	static const String KEY_ROOT;
-	static const String KEY_DATAPOINTS;
-	static const String KEY_CHANNELS;
-	static const String KEY_OUTPUTS;
-	static const String KEY_INPUTS;
-	static const String KEY_VALUE;
-	static const String KEY_VALUES;
-	static const String KEY_DEVICES;
-	static const String KEY_DISPLAYNAME;
-	static const String KEY_SCENESTRIGGERED;
-	static const String KEY_PARAMETERS;
-	static const String VALUE_0;
-	static const String VALUE_1;
+	FAH_DEVICE_HANDLE GetDeviceHandle(FahESPDevice* Device);
+	FahESPDevice* GetDeviceByHandle(const FAH_DEVICE_HANDLE& Handle);
+	FahESPDevice* GetDeviceByFahID(const uint64_t& FahID);
+	void SetRequestRateLimit(const uint16_t& RequestsPerSecond, const uint8_t& Burst);
+	bool AcquireRequestToken();
+	unsigned long MillisUntilRequestToken() { return RequestRateLimit.MillisUntilAvailable(); };
+	unsigned long NextDeadlineMs();
+	FahTimerQueue& GetTimerQueue() { return Timers; };
+	//Protocol keys are stored in flash, see FahFlashString.h
+	static constexpr char KEY_ROOT[] = "00000000-0000-0000-0000-000000000000";
+	static constexpr char KEY_DATAPOINTS[] = "datapoints";
+	static constexpr char KEY_CHANNELS[] = "channels";
+	static constexpr char KEY_OUTPUTS[] = "outputs";
+	static constexpr char KEY_INPUTS[] = "inputs";
+	static constexpr char KEY_VALUE[] = "value";
+	static constexpr char KEY_VALUES[] = "values";
+	static constexpr char KEY_DEVICES[] = "devices";
+	static constexpr char KEY_DISPLAYNAME[] = "displayName";
+	static constexpr char KEY_SCENESTRIGGERED[] = "scenesTriggered";
+	static constexpr char KEY_PARAMETERS[] = "parameters";
+	static constexpr char VALUE_0[] = "0";
+	static constexpr char VALUE_1[] = "1";
 	static const char KEY_DATAPOINT_SEPERATOR = '/';
 private:
+	template<class Policy> friend class FahESPapiStorage;
 	enum httpClientSessionStatus:uint8_t
 	{
 		SESSION_NONE = 0,
@@ -101,11 +143,47 @@ private:
 		PROCESS_ACTIONS = PROCESS_DATAPOINTS | PROCESS_SCENES,
 		PROCESS_ALL = PROCESS_ACTIONS | PROCESS_DEVICES,
 	};
+	enum ApiTimer :uint8_t
+	{
+		TIMER_WS_PING = 0,
+		TIMER_CREATION_TIMEOUT = 1, //Plus the creation slot index
+	};
+	struct PendingDeviceCreation
+	{
+		FahHTTPClient* httpclt = NULL;
+		String SerialNr;
+		String DeviceType;
+		const FahDeviceSchema* Schema = NULL;
+		uint16_t Timeout = 0;
+		uint8_t Handle = 0;
+		FAHESP_DEVICE_CREATED_CALLBACK Callback = NULL;
+		void* Context = NULL;
+		FAH_TIMER_HANDLE TimeoutTimer = 0;
+		bool TimedOut = false;
+	};
+	static constexpr char URI_VIRTUALDEVICE[] = "/fhapi/v1/api/rest/virtualdevice/";
+	static constexpr char URI_DATAPOINT[] = "/fhapi/v1/api/rest/datapoint/";
+	static constexpr char URI_DEVICE[] = "/fhapi/v1/api/rest/device/";
+	FahCapacities Capacities;
 	FahSysAPInfo* SysApInfo = NULL;
 	WebSocketClient* ws = NULL;
-	FahESPDevice* EspDevices[MAX_ESP_CREATED_DEVICES] = { NULL };
-	uint8_t EspDevicesCount;
+	FahDeviceRegistry EspDevices;
+	uint16_t NextDeviceIndex = 0;
+	FahESPDevice* GetNextDeviceWithWork(const bool& Advance);
+	PendingDeviceCreation* PendingCreations = NULL;
+	bool OwnsCreationStorage = false;
+	uint8_t LastCreationHandle = 0;
+	uint8_t GetFreeDeviceSlots();
+	bool StartDeviceRegistration(FahHTTPClient* httpclt, const String& SerialNr, const String& deviceType, const String& DisplayName, const uint16_t& timeout, const bool& async);
+	FahESPDevice* CreateDeviceWithSchema(const String& SerialNr, const String& deviceType, const FahDeviceSchema* Schema, const String& DisplayName, const uint16_t& timeout);
+	uint8_t CreateDeviceWithSchemaAsync(const String& SerialNr, const String& deviceType, const FahDeviceSchema* Schema, const String& DisplayName, const uint16_t& timeout, FAHESP_DEVICE_CREATED_CALLBACK Callback, void* Context);
+	FahESPDevice* CreateDeviceFromResponse(String& Body, const String& SerialNr, const String& deviceType, const FahDeviceSchema* Schema, const uint16_t& timeout);
+	void ProcessPendingCreations();
 	bool bNightActuatorForSysAp = false;
+	FahTimerQueue Timers;
+	FAH_TIMER_HANDLE PingTimer = 0;
+	static void OnTimer(void* Context, const uint8_t& TimerID);
+	FahTokenBucket RequestRateLimit = FahTokenBucket(FAH_REQUEST_RATE_PER_SECOND, FAH_REQUEST_BURST);
 	bool RegisterFahEspDevice(FahESPDevice* Device);
 	bool ProcessJsonData(String& recievedData, JsonProcessFilter filter, uint64_t* hexDeviceOut);	
 	bool isCallbackNeededForHexDevice(uint64_t hexDevice);
@@ -115,6 +193,25 @@ private:
 	void ProcessJsonSceneTrigger(JsonObject& jsonSceneTrigger);
 	bool ProcessJsonNewDevice(JsonObject& jsonDevices, uint64_t* hexDeviceOut);
 	static String GetPadString(const String& refString, const uint8_t &size, const char& padChar);
-	static bool GetKeyIfExistAndGotChildren(JsonObject& rootObject, const String& LookFor, JsonObject& childRef);
-	static bool GetNestedJsonObject(JsonPair& input, JsonObject& output, const String& ExpectedSubKey);
+	static bool GetKeyIfExistAndGotChildren(JsonObject& rootObject, PGM_P LookFor, JsonObject& childRef);
+	static bool GetNestedJsonObject(JsonPair& input, JsonObject& output, PGM_P ExpectedSubKey);
+protected:
+	//Storage of Capacities.MaxPendingCreations and Capacities.MaxTimers entries, allocated once when NULL
+	FreeAtHomeESPapi(const FahCapacities& Capacities, PendingDeviceCreation* CreationStorage, FahTimerQueue::TimerEntry* TimerStorage);
+};
+
+//Fixed size storage of FreeAtHomeESPapiSized, a base class so it is constructed before and destroyed after the api
+template<class Policy> class FahESPapiStorage
+{
+protected:
+	FreeAtHomeESPapi::PendingDeviceCreation CreationStorage[Policy::MaxPendingCreations];
+	FahTimerQueue::TimerEntry TimerStorage[FahTimerCapacity(Policy::MaxDevices, Policy::MaxPendingCreations)];
+};
+
+//FreeAtHomeESPapi sized by a capacity policy at compile time, the queues are part of the object instead of the heap
+template<class Policy = FahDefaultCapacityPolicy> class FreeAtHomeESPapiSized : private FahESPapiStorage<Policy>, public FreeAtHomeESPapi
+{
+	static_assert(Policy::MaxDevices > 0 && Policy::MaxPendingCreations > 0 && Policy::MaxPendingDataPoints > 0, "Capacity policy values must not be 0");
+public:
+	FreeAtHomeESPapiSized() :FreeAtHomeESPapi(FahCapacitiesOf<Policy>(), this->CreationStorage, this->TimerStorage) {};
 };
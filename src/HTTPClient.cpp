@@ -13,7 +13,13 @@
 #include "HTTPClient.h"
 #include <WiFiClientSecure.h>
 
-HTTPClient::HTTPClient(const bool& Secure)
+//Response headers retained by the client, order matches HTTPCLIENT_HEADER
+static const char HEADER_CONTENT_TYPE[] PROGMEM = "content-type";
+static const char HEADER_CONTENT_LENGTH[] PROGMEM = "content-length";
+static const char HEADER_TRANSFER_ENCODING[] PROGMEM = "transfer-encoding";
+static const char* const RetainedHeaderNames[HTTPCLIENT_HEADER::HTTPCLIENT_HEADER_COUNT] PROGMEM = { HEADER_CONTENT_TYPE, HEADER_CONTENT_LENGTH, HEADER_TRANSFER_ENCODING };
+
+HTTPClient::HTTPClient(const bool& Secure, const uint16_t& MaxBodySize, const uint16_t& RequestBufferSize, const uint8_t& LineBufferSize)
 {
     if (Secure)
     {
@@ -25,11 +31,31 @@ HTTPClient::HTTPClient(const bool& Secure)
     {    
         this->client = new WiFiClient();
     }
-    ReturnBody.reserve(MAXBODYSIZE);
+    this->MaxBodySize = MaxBodySize;
+    this->RequestBufferSize = RequestBufferSize;
+    this->LineBufferSize = LineBufferSize;
+    ReturnBody.reserve(MaxBodySize);
 }
 
-bool HTTPClient::Connect(const String& RemoteHost, const unsigned int& port)
-{    	
+bool HTTPClient::Connect(const IPAddress& RemoteAddress, const unsigned int& port)
+{
+    //Same as connecting by name, without the lookup
+    if (!PrepareConnect())
+        return false;
+
+    if (!client->connect(RemoteAddress, port))
+    {
+        DEBUG_PL(F("Connection failed"));
+        return false;
+    }
+
+    SessionStartMillis = millis();
+    this->state = HTTPCLIENT_STATE::HTTPCLIENT_STATE_CONNECTED;
+    return true;
+}
+
+bool HTTPClient::PrepareConnect()
+{
     if(this->state > HTTPCLIENT_STATE::HTTPCLIENT_STATE_CLOSED)
     {
         DEBUG_P(F("Connection in progess: "));
@@ -38,6 +64,13 @@ bool HTTPClient::Connect(const String& RemoteHost, const unsigned int& port)
     }
 
     ClearVariables();
+    return true;
+}
+
+bool HTTPClient::Connect(const String& RemoteHost, const unsigned int& port)
+{    	
+    if (!PrepareConnect())
+        return false;
 
     //#ifdef CHECK_WIFI_CONNECTION_BEFORE_SEND
     //    if (!WiFi.isConnected())
@@ -57,6 +90,32 @@ bool HTTPClient::Connect(const String& RemoteHost, const unsigned int& port)
     return true;
 }
 
+bool HTTPClient::ReadLine()
+{
+    while (client->available())
+    {
+        int c = client->read();
+        if (c < 0)
+            break;
+
+        if (c == '\n')
+        {
+            if ((LineLength > 0) && (LineBuffer[LineLength - 1] == '\r'))
+                LineLength--;
+            LineBuffer[LineLength] = 0;
+            LineLength = 0;
+            return true;
+        }
+
+        //Overlong lines are truncated, only the start of a line is of interest
+        if (LineLength < LineBufferSize - 1)
+        {
+            LineBuffer[LineLength++] = (char)c;
+        }
+    }
+    return false;
+}
+
 bool HTTPClient::ReadResult(uint16_t* resultcode)
 {
     //Todo Add timeout
@@ -64,14 +123,12 @@ bool HTTPClient::ReadResult(uint16_t* resultcode)
     {
         if(sessionOK())
         {
-            if(client->available())
+            if(ReadLine())
             {
-                String line = client->readStringUntil('\n');
-                //DEBUG_PL(line);
-                if (line.indexOf(F("HTTP/")) != -1)
+                //DEBUG_PL(LineBuffer);
+                if ((strncmp_P(LineBuffer, PSTR("HTTP/"), 5) == 0) && (strlen(LineBuffer) >= 12))
                 {
-                    String status = line.substring(9, 12);
-                    LastResult = status.toInt();
+                    LastResult = atoi(&LineBuffer[9]);
                     *resultcode = LastResult;
                     this->state = HTTPCLIENT_STATE::HTTPCLIENT_STATE_HEADERS;
                     return true;
@@ -119,35 +176,56 @@ bool HTTPClient::sessionOK()
     return false;
 }
 
-bool HTTPClient::ReadHeaders(String& Key, String& Value)
+void HTTPClient::ParseHeaderLine()
+{
+    char* col = strchr(LineBuffer, ':');
+    if (col == NULL)
+        return;
+
+    size_t keyLength = col - LineBuffer;
+    for (uint8_t i = 0; i < HTTPCLIENT_HEADER::HTTPCLIENT_HEADER_COUNT; i++)
+    {
+        PGM_P headerName = (PGM_P)pgm_read_ptr(&RetainedHeaderNames[i]);
+        if ((strlen_P(headerName) == keyLength) && (strncasecmp_P(LineBuffer, headerName, keyLength) == 0))
+        {
+            const char* value = col + 1;
+            while (*value == ' ')
+                value++;
+
+            strncpy(HeaderValues[i], value, HTTP_MAX_HEADER_VALUE - 1);
+            HeaderValues[i][HTTP_MAX_HEADER_VALUE - 1] = 0;
+            ReceivedHeaders |= (1 << i);
+
+            if (i == HTTPCLIENT_HEADER::HTTPCLIENT_HEADER_CONTENT_LENGTH)
+            {
+                ContentLength = atol(value);
+            }
+            return;
+        }
+    }
+}
+
+bool HTTPClient::ReadHeaders()
 {
     if(this->state == HTTPCLIENT_STATE::HTTPCLIENT_STATE_HEADERS)
     {
         if(sessionOK())
         {
-            if(client->available())
+            while (ReadLine())
             {
-                String line = client->readStringUntil('\n');
-                //DEBUG_PL(line);
-                if(line.length() <= 1)
+                if (LineBuffer[0] == 0)
                 {
                     //DEBUG_PL(F("END_head"));
-                    this->state = HTTPCLIENT_STATE::HTTPCLIENT_STATE_DATA;
-                }
-                else
-                {
-                    //Todo check max lenght of headers??
-			        int col = line.indexOf(":");
-                    if(col > 0)
+                    if (strstr_P(GetResponseHeader(HTTPCLIENT_HEADER::HTTPCLIENT_HEADER_TRANSFER_ENCODING), PSTR("chunked")) != NULL)
                     {
-			            Key = line.substring(0, col);
-			            Key.toLowerCase();  // Make all headers lowercase for case-insensitve comparison
-			            Value = line.substring(col + 2, line.length() - 1);
-                        ReturnHeaderKeys += Key + "\n";
-                        ReturnHeaderValues += Value + "\n";
-                        return true;                
+                        //Chunked framing takes precedence over Content-Length
+                        ChunkState = HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_SIZE;
+                        ContentLength = -1;
                     }
+                    this->state = HTTPCLIENT_STATE::HTTPCLIENT_STATE_DATA;
+                    return true;
                 }
+                ParseHeaderLine();
             }
         }
         else
@@ -159,53 +237,27 @@ bool HTTPClient::ReadHeaders(String& Key, String& Value)
     return false;
 }
 
+const char* HTTPClient::GetResponseHeader(const HTTPCLIENT_HEADER& header)
+{
+    if ((header < HTTPCLIENT_HEADER::HTTPCLIENT_HEADER_COUNT) && ((ReceivedHeaders & (1 << header)) != 0))
+        return HeaderValues[header];
+    return "";
+}
+
 String HTTPClient::GetResponseHeaderByIndex(const uint8_t &index)
 {
-    uint8_t rowpos = 0;
-    uint16_t end_pos = 0;
-    uint16_t start_pos = 0;
-    while (true)
-    {
-        end_pos = ReturnHeaderValues.indexOf('\n', start_pos);
-        if (end_pos > 0)
-        {
-            if (rowpos == index)
-            {
-                return ReturnHeaderValues.substring(start_pos, end_pos);
-            }
-            start_pos = end_pos + 1;
-            rowpos++;
-        }
-        else
-        {
-            break;
-        }
-    }
+    if (index < HTTPCLIENT_HEADER::HTTPCLIENT_HEADER_COUNT)
+        return String(GetResponseHeader((HTTPCLIENT_HEADER)index));
     return "";
 }
 
 int HTTPClient::GetResponseHeaderIndexByKey(const String& key)
 {
-    uint8_t rowpos = 0;
-    uint16_t end_pos = 0;
-    uint16_t start_pos = 0;
-    while (true)
+    for (uint8_t i = 0; i < HTTPCLIENT_HEADER::HTTPCLIENT_HEADER_COUNT; i++)
     {
-        end_pos = ReturnHeaderKeys.indexOf('\n', start_pos);
-        if (end_pos > 0)
+        if (((ReceivedHeaders & (1 << i)) != 0) && (strcasecmp_P(key.c_str(), (PGM_P)pgm_read_ptr(&RetainedHeaderNames[i])) == 0))
         {
-            String substring = ReturnHeaderKeys.substring(start_pos, end_pos);
-            if (substring == key)
-            {
-                //DEBUG_F("Match %i: Key: %s\r\n", rowpos, substring.c_str());
-                return rowpos;
-            }
-            start_pos = end_pos + 1;
-            rowpos++;
-        }
-        else
-        {
-            break;
+            return i;
         }
     }
     return -1;
@@ -225,35 +277,214 @@ String HTTPClient::GetBody()
     return this->ReturnBody;
 }
 
-bool HTTPClient::ReadPayload()
+bool HTTPClient::isBodyComplete()
+{
+    if (ChunkState != HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_NONE)
+        return (ChunkState == HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_DONE);
+    return (ContentLength >= 0) && (BodyBytesReceived >= (uint32_t)ContentLength);
+}
+
+bool HTTPClient::ParseChunkSize()
 {
-    if(this->state == HTTPCLIENT_STATE::HTTPCLIENT_STATE_DATA)
+    //Chunk size line: hex size, optionally followed by ;extensions
+    uint32_t size = 0;
+    uint8_t digits = 0;
+    for (const char* p = LineBuffer; *p != 0 && *p != ';' && *p != ' ' && *p != '\t'; p++)
     {
-        if(sessionOK())
+        char c = *p;
+        uint8_t nibble;
+        if (c >= '0' && c <= '9')
+            nibble = c - '0';
+        else if (c >= 'a' && c <= 'f')
+            nibble = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F')
+            nibble = c - 'A' + 10;
+        else
+            return false;
+
+        size = (size << 4) | nibble;
+        digits++;
+        if (size > HTTP_MAX_CHUNK_SIZE || digits > 8)
         {
-            if(client->available())
-            {
-                char t = client->read(); 
-                //DEBUG_P(t);
-                if (this->ReturnBody.length() + 1 > MAXBODYSIZE)
+            DEBUG_PL(F("Chunk too large"));
+            return false;
+        }
+    }
+    if (digits == 0)
+        return false;
+
+    ChunkRemaining = size;
+    return true;
+}
+
+int HTTPClient::ReadBodyData(uint8_t* buffer, const size_t& size)
+{
+    if (ChunkState == HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_NONE)
+    {
+        size_t toRead = client->available();
+        if (toRead > size)
+            toRead = size;
+        if ((ContentLength >= 0) && (toRead > ((uint32_t)ContentLength - BodyBytesReceived)))
+            toRead = (uint32_t)ContentLength - BodyBytesReceived;
+        if (toRead == 0)
+            return 0;
+
+        int len = client->read(buffer, toRead);
+        if (len <= 0)
+            return 0;
+        BodyBytesReceived += len;
+        return len;
+    }
+
+    size_t total = 0;
+    while (total < size)
+    {
+        switch (ChunkState)
+        {
+            case HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_SIZE:
+                if (!ReadLine())
+                    return total;
+                if (!ParseChunkSize())
                 {
-                    DEBUG_PL(F("NotAppending ReturnBody, OutOfMem"));
-                }                    
+                    ChunkState = HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_ERROR;
+                    return total;
+                }
+                if (ChunkRemaining == 0)
+                    ChunkState = HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_TRAILER;
                 else
+                    ChunkState = HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_DATA;
+                break;
+
+            case HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_DATA:
+            {
+                size_t toRead = client->available();
+                if (toRead > size - total)
+                    toRead = size - total;
+                if (toRead > ChunkRemaining)
+                    toRead = ChunkRemaining;
+                if (toRead == 0)
+                    return total;
+
+                int len = client->read(buffer + total, toRead);
+                if (len <= 0)
+                    return total;
+                total += len;
+                BodyBytesReceived += len;
+                ChunkRemaining -= len;
+                if (ChunkRemaining == 0)
+                    ChunkState = HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_DATA_END;
+                break;
+            }
+
+            case HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_DATA_END:
+                //Chunk data is terminated by an empty line
+                if (!ReadLine())
+                    return total;
+                if (LineBuffer[0] != 0)
                 {
-                    this->ReturnBody += t;
+                    ChunkState = HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_ERROR;
+                    return total;
                 }
-                return true;
-            }
+                ChunkState = HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_SIZE;
+                break;
+
+            case HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_TRAILER:
+                //Trailer fields after the last chunk, retained headers are picked up as well
+                if (!ReadLine())
+                    return total;
+                if (LineBuffer[0] == 0)
+                {
+                    ChunkState = HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_DONE;
+                    return total;
+                }
+                ParseHeaderLine();
+                break;
+
+            default:
+                return total;
+        }
+    }
+    return total;
+}
+
+int HTTPClient::ReadBody(uint8_t* buffer, const size_t& size)
+{
+    if(this->state != HTTPCLIENT_STATE::HTTPCLIENT_STATE_DATA)
+        return 0;
+
+    if (isBodyComplete())
+    {
+        //Complete body received, no need to wait for the server to close
+        this->client->stop();
+        this->state = HTTPCLIENT_STATE::HTTPCLIENT_STATE_CLOSED;
+        return 0;
+    }
+
+    if(!sessionOK())
+    {
+        this->client->stop();
+        //Serial.println("Stopping");
+        if ((ChunkState != HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_NONE) || (ContentLength >= 0))
+        {
+            //Session closed before the announced body was complete
+            this->state = HTTPCLIENT_STATE::HTTPCLIENT_STATE_FAILED;
         }
         else
         {
-            this->client->stop();
-            //Serial.println("Stopping");
             this->state = HTTPCLIENT_STATE::HTTPCLIENT_STATE_CLOSED;
         }
+        return 0;
     }
-    return false;
+
+    int len = ReadBodyData(buffer, size);
+
+    if (ChunkState == HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_ERROR)
+    {
+        DEBUG_PL(F("Invalid chunked encoding"));
+        this->client->stop();
+        this->state = HTTPCLIENT_STATE::HTTPCLIENT_STATE_FAILED;
+    }
+    else if (isBodyComplete())
+    {
+        this->client->stop();
+        this->state = HTTPCLIENT_STATE::HTTPCLIENT_STATE_CLOSED;
+    }
+    return len;
+}
+
+bool HTTPClient::ReadPayload()
+{
+    bool dataRead = false;
+    uint8_t buffer[HTTP_PAYLOAD_READ_CHUNK];
+    int len;
+    while ((len = ReadBody(buffer, sizeof(buffer))) > 0)
+    {
+        dataRead = true;
+
+        if (BodySink != NULL)
+        {
+            if (!BodySink->Write(buffer, len))
+            {
+                DEBUG_PL(F("Body rejected by sink"));
+                this->client->stop();
+                this->state = HTTPCLIENT_STATE::HTTPCLIENT_STATE_FAILED;
+                return dataRead;
+            }
+            continue;
+        }
+
+        size_t append = len;
+        if (this->ReturnBody.length() + append > MaxBodySize)
+        {
+            DEBUG_PL(F("NotAppending ReturnBody, OutOfMem"));
+            append = MaxBodySize - this->ReturnBody.length();
+        }
+        if (append > 0)
+        {
+            this->ReturnBody.concat((const char*)buffer, append);
+        }
+    }
+    return dataRead;
 }
 
 bool HTTPClient::FullRequest(const String& Host, const String& URL, const String& PostData)
@@ -264,10 +495,33 @@ bool HTTPClient::FullRequest(const String& Host, const String& URL, const String
 void HTTPClient::ClearVariables()
 {
     AdditionalHeaders = "";
-    ReturnHeaderKeys = "";
-    ReturnHeaderValues = "";
+    ReceivedHeaders = 0;
+    LineLength = 0;
     LastResult = 0;
+    ContentLength = -1;
+    BodyBytesReceived = 0;
+    ChunkState = HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_NONE;
+    ChunkRemaining = 0;
     ReturnBody = "";
+    BodySink = NULL;
+}
+
+void HTTPClient::AllocateBuffers()
+{
+    //One allocation for the lifetime of the client, requests do not allocate from the heap
+    if (RequestBuffer != NULL)
+        return;
+    RequestBuffer = new char[RequestBufferSize + LineBufferSize + HTTPCLIENT_HEADER::HTTPCLIENT_HEADER_COUNT * HTTP_MAX_HEADER_VALUE];
+    LineBuffer = RequestBuffer + RequestBufferSize;
+    HeaderValues = (char (*)[HTTP_MAX_HEADER_VALUE])(LineBuffer + LineBufferSize);
+}
+
+int HTTPClient::available()
+{
+    //Bytes waiting on the socket, for callers that only want to poll when there is something to read
+    if (this->state < HTTPCLIENT_STATE::HTTPCLIENT_STATE_CONNECTED)
+        return 0;
+    return this->client->available();
 }
 
 void HTTPClient::abort()
@@ -281,29 +535,65 @@ void HTTPClient::abort()
     }
 }
 
+bool HTTPClient::AppendToRequest(size_t& pos, const char* data, size_t length, const bool& isProgmem)
+{
+    while (length > 0)
+    {
+        if (pos == RequestBufferSize)
+        {
+            //Request does not fit the buffer, send what is there and continue
+            if (client->write((const uint8_t*)RequestBuffer, pos) != pos)
+                return false;
+            pos = 0;
+        }
+
+        size_t part = RequestBufferSize - pos;
+        if (part > length)
+            part = length;
+        if (isProgmem)
+            memcpy_P(RequestBuffer + pos, data, part);
+        else
+            memcpy(RequestBuffer + pos, data, part);
+        pos += part;
+        data += part;
+        length -= part;
+    }
+    return true;
+}
+
 bool HTTPClient::Request(const String& HTTPCommand, const String& URL, const String& PostData)
 {
     if (this->state == HTTPCLIENT_STATE::HTTPCLIENT_STATE_CONNECTED)
     {
-        //Set http version to 1.0 to disable chunked responses
-        String HTTPrequestPacket = HTTPCommand + " " + URL + F(" HTTP/1.0\r\nConnection: Close\r\n");
+        //The whole request is serialized into RequestBuffer and sent with a single write if it fits
+        //Chunked responses are decoded by ReadPayload, the session is still closed after each request
+        AllocateBuffers();
+        size_t pos = 0;
+        bool ok = AppendToRequest(pos, HTTPCommand.c_str(), HTTPCommand.length(), false);
+        ok = ok && AppendToRequest(pos, PSTR(" "), 1, true);
+        ok = ok && AppendToRequest(pos, URL.c_str(), URL.length(), false);
+        PGM_P requestLine = PSTR(" HTTP/1.1\r\nConnection: Close\r\n");
+        ok = ok && AppendToRequest(pos, requestLine, strlen_P(requestLine), true);
 
         if (PostData.length() != 0)
         {
-            String slen = String(PostData.length());
-            HTTPrequestPacket += String(F("Content-Length: ")) + slen + String(F("\r\n"));
+            char slen[12];
+            utoa(PostData.length(), slen, 10);
+            PGM_P contentLength = PSTR("Content-Length: ");
+            ok = ok && AppendToRequest(pos, contentLength, strlen_P(contentLength), true);
+            ok = ok && AppendToRequest(pos, slen, strlen(slen), false);
+            ok = ok && AppendToRequest(pos, PSTR("\r\n"), 2, true);
         }
 
-        HTTPrequestPacket += AdditionalHeaders;
-
-        if (PostData.length() != 0)
-            HTTPrequestPacket += String(F("\r\n")) + PostData;
-        else
-            HTTPrequestPacket += String(F("\r\n"));
+        if (StaticHeaders != NULL)
+        {
+            ok = ok && AppendToRequest(pos, StaticHeaders->c_str(), StaticHeaders->length(), false);
+        }
+        ok = ok && AppendToRequest(pos, AdditionalHeaders.c_str(), AdditionalHeaders.length(), false);
+        ok = ok && AppendToRequest(pos, PSTR("\r\n"), 2, true);
+        ok = ok && AppendToRequest(pos, PostData.c_str(), PostData.length(), false);
 
-        //DEBUG_PL(HTTPrequestPacket);
-        size_t ret = client->write(HTTPrequestPacket.c_str());
-        if (ret == HTTPrequestPacket.length())
+        if (ok && (client->write((const uint8_t*)RequestBuffer, pos) == pos))
         {
             state = HTTPCLIENT_STATE::HTTPCLIENT_STATE_REQUESTED;
             return true;
@@ -316,6 +606,11 @@ bool HTTPClient::Request(const String& HTTPCommand, const String& URL, const Str
     return false;
 }
 
+void HTTPClient::SetStaticRequestHeaders(const String* Headers)
+{
+    this->StaticHeaders = Headers;
+}
+
 void HTTPClient::AddRequestHeader(const String &Key, const String &Value)
 {
     this->AdditionalHeaders += Key + ": " + Value + "\r\n";
@@ -338,4 +633,9 @@ HTTPClient::~HTTPClient()
         delete this->client;
         this->client  = NULL;
     }
+    if (RequestBuffer != NULL)
+    {
+        delete[] RequestBuffer;
+        RequestBuffer = NULL;
+    }
 }
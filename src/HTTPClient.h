@@ -14,7 +14,9 @@
 #include <WiFiClient.h>
 #include "FahESPBuildConfig.h"
 
-#define MAXBODYSIZE 2048
+#define HTTP_PAYLOAD_READ_CHUNK 128
+#define HTTP_MAX_HEADER_VALUE 32
+#define HTTP_MAX_CHUNK_SIZE 0x100000 //Chunk size lines announcing more are rejected
 
 namespace HTTPCLIENT_STATES
 {
@@ -31,35 +33,98 @@ namespace HTTPCLIENT_STATES
 }
 typedef HTTPCLIENT_STATES::HTTPCLIENT_STATE HTTPCLIENT_STATE;
 
+namespace HTTPCLIENT_HEADERS
+{
+	enum HTTPCLIENT_HEADER :uint8_t
+	{
+		HTTPCLIENT_HEADER_CONTENT_TYPE = 0,
+		HTTPCLIENT_HEADER_CONTENT_LENGTH = 1,
+		HTTPCLIENT_HEADER_TRANSFER_ENCODING = 2,
+		HTTPCLIENT_HEADER_COUNT = 3,
+	};
+}
+typedef HTTPCLIENT_HEADERS::HTTPCLIENT_HEADER HTTPCLIENT_HEADER;
+
+namespace HTTPCLIENT_CHUNK_STATES
+{
+	enum HTTPCLIENT_CHUNK_STATE :uint8_t
+	{
+		HTTPCLIENT_CHUNK_NONE = 0,
+		HTTPCLIENT_CHUNK_SIZE = 1,
+		HTTPCLIENT_CHUNK_DATA = 2,
+		HTTPCLIENT_CHUNK_DATA_END = 3,
+		HTTPCLIENT_CHUNK_TRAILER = 4,
+		HTTPCLIENT_CHUNK_DONE = 5,
+		HTTPCLIENT_CHUNK_ERROR = 6,
+	};
+}
+typedef HTTPCLIENT_CHUNK_STATES::HTTPCLIENT_CHUNK_STATE HTTPCLIENT_CHUNK_STATE;
+
+//Receives the decoded response body as it arrives, instead of the body String
+class HTTPBodySink
+{
+public:
+    virtual bool Write(const uint8_t* Data, const size_t& Length) = 0; //False rejects the body and fails the request
+    virtual ~HTTPBodySink() {};
+};
+
 class HTTPClient
 {
 private:
     WiFiClient* client = NULL;
     HTTPCLIENT_STATE state = HTTPCLIENT_STATE::HTTPCLIENT_STATE_INITIAL;
     String AdditionalHeaders = "";
-    String ReturnHeaderKeys = "";
-    String ReturnHeaderValues = "";
+    const String* StaticHeaders = NULL;
+    char* RequestBuffer = NULL; //Allocated on the first request together with LineBuffer and HeaderValues, kept until the client is destroyed
+    uint16_t RequestBufferSize = HTTP_REQUEST_BUFFER_SIZE;
+    bool AppendToRequest(size_t& pos, const char* data, size_t length, const bool& isProgmem);
+    char* LineBuffer = NULL;
+    uint8_t LineBufferSize = HTTP_MAX_HEADER_LINE;
+    uint8_t LineLength = 0;
+    char (*HeaderValues)[HTTP_MAX_HEADER_VALUE] = NULL;
+    void AllocateBuffers();
+    uint8_t ReceivedHeaders = 0;
+    bool ReadLine();
+    void ParseHeaderLine();
     String ReturnBody = "";
+    uint16_t MaxBodySize = MAXBODYSIZE;
+    HTTPBodySink* BodySink = NULL; //Set for the current request only
     uint16_t LastResult = 0;
+    int32_t ContentLength = -1;
+    uint32_t BodyBytesReceived = 0;
+    HTTPCLIENT_CHUNK_STATE ChunkState = HTTPCLIENT_CHUNK_STATE::HTTPCLIENT_CHUNK_NONE;
+    uint32_t ChunkRemaining = 0;
+    bool ParseChunkSize();
+    int ReadBodyData(uint8_t* buffer, const size_t& size);
+    int ReadBody(uint8_t* buffer, const size_t& size);
+    bool isBodyComplete();
     void ClearVariables();
+    bool PrepareConnect();
     unsigned long SessionStartMillis = 0;
 public:
-    HTTPClient(const bool &secure);
+    //The request and line buffers are allocated once, when the first request is sent
+    HTTPClient(const bool &secure, const uint16_t& MaxBodySize = MAXBODYSIZE, const uint16_t& RequestBufferSize = HTTP_REQUEST_BUFFER_SIZE, const uint8_t& LineBufferSize = HTTP_MAX_HEADER_LINE);
     unsigned long GetSessionStartMillis() { return SessionStartMillis; };
-    bool Connect(const String &RemoteHost, const unsigned int &port);    
+    bool Connect(const String &RemoteHost, const unsigned int &port);
+    bool Connect(const IPAddress& RemoteAddress, const unsigned int& port);    
     ~HTTPClient();
     bool Request(const String &HTTPCommand, const String &URL, const String &PostData);
     bool ReadResult(uint16_t *resultcode);
     HTTPCLIENT_STATE GetState();
     bool sessionOK();
-    bool ReadHeaders(String &Key, String& Value);
+    bool ReadHeaders();
+    const char* GetResponseHeader(const HTTPCLIENT_HEADER& header);
     String GetResponseHeaderByIndex(const uint8_t& index);
     int GetResponseHeaderIndexByKey(const String& key);
     String GetResponseHeaderByKey(const String& key);
     String GetBody();
+    int32_t GetContentLength() { return ContentLength; };
     bool ReadPayload();
+    void SetBodySink(HTTPBodySink* Sink) { BodySink = Sink; };
+    int available();
     void abort();
     bool FullRequest(const String &Host, const String &URL, const String &PostData);
     void AddRequestHeader(const String &Key, const String &Value);
     void ClearRequestHeaders();
+    void SetStaticRequestHeaders(const String* Headers);
 };
\ No newline at end of file
@@ -78,7 +78,26 @@ bool WebSocketClient::connect(const String& host, const String& path, uint16_t p
 		DEBUG_PL(String(F("No connection to host")));
 		return false;
 	}
+	return handshake(host, path);
+}
+
+bool WebSocketClient::connect(const IPAddress& address, const String& host, const String& path, uint16_t port)
+{
+	if (isConnected())
+	{
+		//Already connected
+		return true;
+	}
+	if (!client->connect(address, port))
+	{
+		DEBUG_PL(String(F("No connection to host")));
+		return false;
+	}
+	return handshake(host, path);
+}
 
+bool WebSocketClient::handshake(const String& host, const String& path)
+{
 	// send handshake
 	String handshake = String(F("GET ")) + path + String(F(" HTTP/1.1\r\nHost: ")) + host + 
 			String(F("\r\nConnection: Upgrade\r\nUpgrade: websocket\r\nSec-WebSocket-Version: 13\r\nSec-WebSocket-Key: ")) +
@@ -142,7 +161,6 @@ bool WebSocketClient::connect(const String& host, const String& path, uint16_t p
 	if (success) {
 		DEBUG_PL(F("[WS] sucessfully connected"));
         this->websocketEstablished = true;
-		this->LastWaitInterval = millis();
     }
 	else {
 		DEBUG_PL(F("[WS] could not connect"));
@@ -224,14 +242,10 @@ int WebSocketClient::timedRead()
 	return client->read();
 }
 
-void WebSocketClient::sendKeepAlive()
+void WebSocketClient::sendPing()
 {
-	if ((millis() - this->LastWaitInterval) > WS_PING_INTERVAL_TIMEOUT)
-	{
-		//DEBUG_PL(F("ping"));
-		send(String(F("{}")), WS_OPCODE_PING);
-		this->LastWaitInterval = millis();
-	}
+	//DEBUG_PL(F("ping"));
+	send(String(F("{}")), WS_OPCODE_PING);
 }
 
 bool WebSocketClient::getMessage(String& message) {
@@ -251,7 +265,6 @@ bool WebSocketClient::getMessage(String& message) {
 
 	if (!client->available())
 	{
-		sendKeepAlive();
 		return false;
 	}
 
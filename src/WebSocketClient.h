@@ -13,6 +13,8 @@ public:
 
 	bool connect(const String& host, const String& path, uint16_t port);
 
+	bool connect(const IPAddress& address, const String& host, const String& path, uint16_t port);
+
 	bool isConnected();
 
 	int Available();
@@ -25,11 +27,11 @@ public:
 
 	void setAuthorizationHeader(const String& header);
 
+	void sendPing();
+
 private:
 	int timedRead();
 
-	void sendKeepAlive();
-
 	void send(const String& str, const uint8_t& wsOpcode);
 
     void write(uint8_t data);
@@ -38,14 +40,14 @@ private:
 
 	String generateKey();
 
+	bool handshake(const String& host, const String& path);
+
 	WiFiClient *client;
 
 	String authorizationHeader = "";
 
     bool websocketEstablished = false;
 
-	unsigned long LastWaitInterval = 0;
-
 };
 
 #endif //WEBSOCKETCLIENT_H